@@ -20,6 +20,7 @@
 
 #include "cpu_backend.hpp"
 #include "contrib/mlir/backend/pass/affine_lowerer.hpp"
+#include "contrib/mlir/backend/pass/loop_parallelization.hpp"
 #include "contrib/mlir/utils.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/env_util.hpp"
@@ -42,6 +43,10 @@
 #include <mlir/Transforms/DialectConversion.h>
 #include <mlir/Transforms/Passes.h>
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #define DEBUG_TYPE "mlir-cpu-backend"
 
 // *** Optimization flags ***
@@ -74,6 +79,24 @@ static llvm::cl::opt<unsigned> clLoopTilingCacheSize(
                    "inferred from the host CPU using for the cache level specified by "
                    "-ngraph-loop-tile-cache-level."));
 
+static llvm::cl::opt<bool> clEnableAffineVectorization(
+    "ngraph-affine-vectorize",
+    llvm::cl::init(false),
+    llvm::cl::desc("Enable super-vectorization of innermost loops in Affine dialect"));
+
+static llvm::cl::opt<unsigned> clVectorizationWidth(
+    "ngraph-affine-vector-width",
+    llvm::cl::init(0),
+    llvm::cl::desc("Number of elements per vector used by affine super-vectorization. If "
+                   "zero, it is derived from the widest vector register of the host CPU "
+                   "assuming 32-bit elements."));
+
+static llvm::cl::opt<bool> clEnableAffineParallelization(
+    "ngraph-affine-parallelize",
+    llvm::cl::init(false),
+    llvm::cl::desc("Outline outermost parallel loops in Affine dialect and run them on the "
+                   "CPU backend thread pool"));
+
 // Enable the lowering of MemRefs to LLVM bare pointers.
 extern llvm::cl::opt<bool> clEnableBarePtrMemRefLowering;
 
@@ -135,8 +158,35 @@ static unsigned getCacheLevelSize(llvm::TargetTransformInfo& targetInfo,
         NGRAPH_UNREACHABLE("Unsupported cache level: ", cacheLevel, ". Only 1 and 2 are supported");
     }
 
-    NGRAPH_CHECK(optCacheLevelSize.hasValue() && "Cache level size is not available in TTI");
-    return optCacheLevelSize.getValue();
+    if (optCacheLevelSize.hasValue())
+    {
+        return optCacheLevelSize.getValue();
+    }
+
+    // Most x86 subtargets do not report cache sizes through TTI. Ask the OS before
+    // settling for conservative defaults.
+    long osCacheSize = 0;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+    osCacheSize = sysconf(cacheLevel == 1 ? _SC_LEVEL1_DCACHE_SIZE : _SC_LEVEL2_CACHE_SIZE);
+#endif
+    unsigned cacheSize = osCacheSize > 0 ? static_cast<unsigned>(osCacheSize)
+                                         : (cacheLevel == 1 ? 32 * 1024 : 256 * 1024);
+    LLVM_DEBUG(llvm::dbgs() << "Cache level " << cacheLevel
+                            << " size not available in TTI, using " << cacheSize
+                            << " bytes.\n");
+    return cacheSize;
+}
+
+/// Returns the number of elements per vector used by super-vectorization.
+static int64_t getVectorizationWidth(llvm::TargetTransformInfo& targetInfo)
+{
+    if (clVectorizationWidth)
+    {
+        return clVectorizationWidth;
+    }
+    // Elementwise kernels are dominated by f32
+    unsigned registerBits = targetInfo.getRegisterBitWidth(/*Vector=*/true);
+    return std::max(registerBits / 32, 4u);
 }
 
 void MLIRCPUBackend::init()
@@ -208,18 +258,30 @@ void MLIRCPUBackend::lowerStandardDialect()
     // 'clEnableBarePtrMemRefLowering' is
     // specified, we lower memref arguments to bare pointers to the memref element
     // type.
+    LowerToLLVMOptions llvmOptions;
     if (clEnableBarePtrMemRefLowering)
     {
-        LowerToLLVMOptions llvmOptions;
-        llvmOptions.useBarePtrCallConv = true, llvmOptions.emitCWrappers = false,
-        pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
+        llvmOptions.useBarePtrCallConv = true;
+        llvmOptions.emitCWrappers = false;
+    }
+    else
+    {
+        llvmOptions.useBarePtrCallConv = false;
+        llvmOptions.emitCWrappers = true;
+    }
+    if (clEnableAffineVectorization)
+    {
+        // Vector ops produced by super-vectorization are lowered together with Std
+        pm.addPass(mlir::createLowerToLLVMWithVectorsPass(llvmOptions));
     }
     else
     {
-        LowerToLLVMOptions llvmOptions;
-        llvmOptions.useBarePtrCallConv = false, llvmOptions.emitCWrappers = true,
         pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
     }
+    if (clEnableAffineParallelization)
+    {
+        pm.addPass(mlir::createParallelDispatchLoweringPass());
+    }
 
     // Apply any generic pass manager command line options.
     mlir::applyPassManagerCLOptions(pm);
@@ -273,6 +335,20 @@ void MLIRCPUBackend::optimizeAffineDialect()
         pm.addPass(mlir::createLoopTilingPass(cacheLevelSize));
     }
 
+    if (clEnableAffineParallelization)
+    {
+        // Outline after tiling so that tile loops, not point loops, are distributed
+        pm.addPass(mlir::createAffineParallelOutliningPass());
+    }
+
+    if (clEnableAffineVectorization)
+    {
+        int64_t vectorWidth = getVectorizationWidth(targetInfo);
+        LLVM_DEBUG(llvm::dbgs() << "Enabling Affine super-vectorization with width "
+                                << vectorWidth << ".\n");
+        pm.addPass(mlir::createSuperVectorizePass({vectorWidth}));
+    }
+
     // Populate pass manager with affine-to-loop and loop-to-std dialect
     // conversions.
     pm.addPass(mlir::createLowerAffinePass());
@@ -286,5 +362,9 @@ void MLIRCPUBackend::optimizeAffineDialect()
     NGRAPH_CHECK(succeeded(result), "Affine optimizaitons and convertion to Std dialect failed");
 
     // Run Std dialect optimizations.
-    // TODO
+    mlir::PassManager stdPm(&m_context);
+    stdPm.addPass(mlir::createCanonicalizerPass());
+    stdPm.addPass(mlir::createCSEPass());
+    mlir::applyPassManagerCLOptions(stdPm);
+    NGRAPH_CHECK(succeeded(stdPm.run(m_module.get())), "Std dialect optimizations failed");
 }
@@ -188,6 +188,12 @@ namespace
                                PatternRewriter& rewriter,
                                DialectLoweringPass& pass);
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass);
+
     // Generates a convolution kernel that can be used to generate single or
     // group convolution. It can handle filters where C_OUT dim includes
     // all groups, or if groups is an additional dimension before C_OUT.
@@ -227,6 +233,16 @@ namespace
 
     Value createZeroConstant(mlir::Type type);
     Value createOneConstant(mlir::Type type);
+    Value createFloatConstant(double value, mlir::Type type);
+
+    // Builds tanh(x) from arithmetic ops only so that it vectorizes along with the rest of
+    // the loop body.
+    Value createTanh(Value x);
+    // Builds lhs^rhs for floating-point operands.
+    Value createPow(Value lhs, Value rhs);
+    // Casts a scalar of type srcTy to dstTy. isSignedSrc selects sign or zero extension for
+    // integers.
+    Value createConvert(Value val, Type dstTy, bool isSignedSrc);
 
     /// Conversion from types in the nGraph dialect to the Standard dialect.
     class NGraphTypeConverter : public TypeConverter
@@ -1347,6 +1363,185 @@ namespace
         return success();
     }
 
+    REWRITER(NGExpOp)
+    {
+        lowerUnaryElementwise<mlir::NGExpOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGLogOp)
+    {
+        lowerUnaryElementwise<mlir::NGLogOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGSqrtOp)
+    {
+        lowerUnaryElementwise<mlir::NGSqrtOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGTanhOp)
+    {
+        lowerUnaryElementwise<mlir::NGTanhOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGSigmoidOp)
+    {
+        lowerUnaryElementwise<mlir::NGSigmoidOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGConvertOp)
+    {
+        lowerUnaryElementwise<mlir::NGConvertOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGPowOp)
+    {
+        lowerBinaryElementwise<mlir::NGPowOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGSelectOp)
+    {
+        auto loc = cast<NGSelectOp>(op).getLoc();
+        auto result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(result.getType().isa<MemRefType>());
+
+        ScopedContext scope(rewriter, loc);
+        Value pred = operands[0];
+        Value lhs = operands[1];
+        Value rhs = operands[2];
+        MemRefBoundsCapture vRes(result);
+        AffineIndexedValue iRes(result), iPred(pred), iLHS(lhs), iRHS(rhs);
+        Type predTy = pred.getType().cast<MemRefType>().getElementType();
+
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        auto steps = vRes.getSteps();
+        affineLoopNestBuilder(lbs, ubs, steps, [&](ValueRange ivRange) {
+            auto ivs = llvm::to_vector<4>(ivRange);
+            Value predVal = iPred(ivs);
+            iRes(ivs) = std_select(
+                ne(predVal, createZeroConstant(predTy)), Value(iLHS(ivs)), Value(iRHS(ivs)));
+        });
+
+        rewriter.replaceOp(op, {result});
+        return success();
+    }
+
+    REWRITER(NGBroadcastOp)
+    {
+        auto broadcast = cast<NGBroadcastOp>(op);
+        auto loc = broadcast.getLoc();
+        auto result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(result.getType().isa<MemRefType>());
+
+        ScopedContext scope(rewriter, loc);
+        Value arg = operands[0];
+        MemRefBoundsCapture vRes(result);
+        AffineIndexedValue iRes(result), iArg(arg);
+
+        unsigned resRank = result.getType().cast<MemRefType>().getRank();
+        SmallVector<bool, 4> isBroadcastAxis(resRank, false);
+        for (auto attr : broadcast.axisSet())
+        {
+            isBroadcastAxis[attr.cast<IntegerAttr>().getInt()] = true;
+        }
+
+        // res[i_0, .., i_n] = arg[i_k for every non-broadcast axis k]
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        auto steps = vRes.getSteps();
+        affineLoopNestBuilder(lbs, ubs, steps, [&](ValueRange ivRange) {
+            auto ivs = llvm::to_vector<4>(ivRange);
+            SmallVector<Value, 4> argIndices;
+            for (unsigned i = 0; i < resRank; i++)
+            {
+                if (!isBroadcastAxis[i])
+                {
+                    argIndices.push_back(ivs[i]);
+                }
+            }
+            iRes(ivs) = iArg(argIndices);
+        });
+
+        rewriter.replaceOp(op, {result});
+        return success();
+    }
+
+    REWRITER(NGReshapeOp)
+    {
+        auto reshape = cast<NGReshapeOp>(op);
+        auto loc = reshape.getLoc();
+        auto result = pass.buildOutputDefs(op, rewriter)[0];
+        NGRAPH_CHECK(result.getType().isa<MemRefType>());
+
+        ScopedContext scope(rewriter, loc);
+        Value arg = operands[0];
+        MemRefBoundsCapture vRes(result);
+        AffineIndexedValue iRes(result), iArg(arg);
+
+        auto resShape = result.getType().cast<MemRefType>().getShape();
+        auto argShape = arg.getType().cast<MemRefType>().getShape();
+        SmallVector<int64_t, 4> axisOrder;
+        for (auto attr : reshape.axisOrder())
+        {
+            axisOrder.push_back(attr.cast<IntegerAttr>().getInt());
+        }
+
+        // Row-major strides of the result and of the argument read in axis order
+        SmallVector<int64_t, 4> resStrides(resShape.size(), 1);
+        for (int i = static_cast<int>(resShape.size()) - 2; i >= 0; i--)
+        {
+            resStrides[i] = resStrides[i + 1] * resShape[i + 1];
+        }
+        SmallVector<int64_t, 4> orderedStrides(axisOrder.size(), 1);
+        for (int i = static_cast<int>(axisOrder.size()) - 2; i >= 0; i--)
+        {
+            orderedStrides[i] = orderedStrides[i + 1] * argShape[axisOrder[i + 1]];
+        }
+
+        // Linearize the result index and delinearize it over the reordered argument axes.
+        // All index math is affine so the copy stays analyzable by later affine passes.
+        auto lbs = vRes.getLbs();
+        auto ubs = vRes.getUbs();
+        auto steps = vRes.getSteps();
+        affineLoopNestBuilder(lbs, ubs, steps, [&](ValueRange ivRange) {
+            auto ivs = llvm::to_vector<4>(ivRange);
+            Value linear = std_constant_index(0);
+            for (unsigned i = 0; i < ivs.size(); i++)
+            {
+                linear = linear + ivs[i] * std_constant_index(resStrides[i]);
+            }
+            SmallVector<Value, 4> argIndices(argShape.size());
+            for (unsigned i = 0; i < axisOrder.size(); i++)
+            {
+                argIndices[axisOrder[i]] = floorDiv(linear, std_constant_index(orderedStrides[i])) %
+                                           std_constant_index(argShape[axisOrder[i]]);
+            }
+            iRes(ivs) = iArg(argIndices);
+        });
+
+        rewriter.replaceOp(op, {result});
+        return success();
+    }
+
+    REWRITER(NGSumRedOp)
+    {
+        lowerAxisReduction<mlir::NGSumRedOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
+    REWRITER(NGMaxRedOp)
+    {
+        lowerAxisReduction<mlir::NGMaxRedOp>(op, operands, rewriter, pass);
+        return success();
+    }
+
     REWRITER(NGDotOp)
     {
         auto dot = cast<NGDotOp>(op);
@@ -2618,6 +2813,34 @@ namespace
                 iRes(ivs) = std_select(
                     is_signed(ngTensorType) ? slt(val, zero) : ult(val, zero), zero - val, val);
             }
+            else if (isa<NGExpOp>(op))
+            {
+                iRes(ivs) = ValueBuilder<ExpOp>(val);
+            }
+            else if (isa<NGLogOp>(op))
+            {
+                iRes(ivs) = ValueBuilder<LogOp>(val);
+            }
+            else if (isa<NGSqrtOp>(op))
+            {
+                iRes(ivs) = ValueBuilder<SqrtOp>(val);
+            }
+            else if (isa<NGTanhOp>(op))
+            {
+                iRes(ivs) = createTanh(val);
+            }
+            else if (isa<NGSigmoidOp>(op))
+            {
+                // 1 / (1 + exp(-x)) saturates cleanly at both ends
+                Value one = createOneConstant(elemTy);
+                Value zero = createZeroConstant(elemTy);
+                iRes(ivs) = one / (one + ValueBuilder<ExpOp>(zero - val));
+            }
+            else if (isa<NGConvertOp>(op))
+            {
+                Type resTy = result.getType().cast<MemRefType>().getElementType();
+                iRes(ivs) = createConvert(val, resTy, is_signed(ngTensorType));
+            }
             else
             {
                 NGRAPH_CHECK(false, "Unsupported op");
@@ -2739,6 +2962,10 @@ namespace
                     iRes(ivs) = std_select(
                         is_signed(ngTensorType) ? slt(left, right) : ult(left, right), left, right);
                 }
+                else if (isa<NGPowOp>(op))
+                {
+                    iRes(ivs) = createPow(left, right);
+                }
                 else
                 {
                     NGRAPH_CHECK(false, "Unsupported op");
@@ -2964,6 +3191,219 @@ namespace
         rewriter.replaceOp(op, result);
     }
 
+    template <typename RedOp>
+    void lowerAxisReduction(Operation* op,
+                            ArrayRef<Value> operands,
+                            PatternRewriter& rewriter,
+                            DialectLoweringPass& pass)
+    {
+        static_assert(std::is_same<RedOp, NGSumRedOp>() || std::is_same<RedOp, NGMaxRedOp>(),
+                      "Template parameter is not supported by lowerAxisReduction");
+
+        RedOp redOp = cast<RedOp>(op);
+        auto loc = redOp.getLoc();
+
+        NGRAPH_CHECK(operands.size() == 1 && operands[0] != nullptr,
+                     "Expected one non-null operand in Axis Reduction op");
+
+        ScopedContext scope(rewriter, loc);
+        Value arg = operands[0];
+        Value result = pass.buildOutputDefs(op, rewriter)[0];
+
+        unsigned argRank = arg.getType().cast<MemRefType>().getRank();
+        SmallVector<bool, 4> isReductionAxis(argRank, false);
+        for (auto attr : redOp.axes())
+        {
+            isReductionAxis[attr.cast<IntegerAttr>().getInt()] = true;
+        }
+
+        // Views
+        MemRefBoundsCapture vRes(result), vArg(arg);
+        // Index Values
+        AffineIndexedValue iRes(result), iArg(arg);
+        // Bounds Index Handles
+        auto resLbs = vRes.getLbs();
+        auto resUbs = vRes.getUbs();
+        auto argLbs = vArg.getLbs();
+        auto argUbs = vArg.getUbs();
+        Type elemTy = result.getType().cast<MemRefType>().getElementType();
+
+        NGRAPH_CHECK(op->getOperands()[0].getType().isa<NGTensorType>());
+        auto ngTensorType = op->getOperands()[0].getType().dyn_cast<NGTensorType>();
+
+        // Initialize the result. Sum starts at zero, Max starts at the first element of each
+        // reduced slice so that no type-specific lowest value is needed.
+        affineLoopNestBuilder(resLbs, resUbs, vRes.getSteps(), [&](ValueRange ivRange) {
+            auto ivs = llvm::to_vector<4>(ivRange);
+            if (std::is_same<RedOp, NGSumRedOp>())
+            {
+                iRes(ivs) = createZeroConstant(elemTy);
+            }
+            else
+            {
+                SmallVector<Value, 4> argIndices;
+                for (unsigned i = 0, j = 0; i < argRank; i++)
+                {
+                    argIndices.push_back(isReductionAxis[i] ? std_constant_index(0) : ivs[j++]);
+                }
+                iRes(ivs) = iArg(argIndices);
+            }
+        });
+
+        // res[non-reduced ivs] = res[non-reduced ivs] (+|max) arg[ivs]
+        affineLoopNestBuilder(argLbs, argUbs, vArg.getSteps(), [&](ValueRange ivRange) {
+            auto ivs = llvm::to_vector<4>(ivRange);
+            SmallVector<Value, 4> resIndices;
+            for (unsigned i = 0; i < argRank; i++)
+            {
+                if (!isReductionAxis[i])
+                {
+                    resIndices.push_back(ivs[i]);
+                }
+            }
+            Value curr = iRes(resIndices);
+            Value val = iArg(ivs);
+            if (std::is_same<RedOp, NGSumRedOp>())
+            {
+                iRes(resIndices) = curr + val;
+            }
+            else
+            {
+                iRes(resIndices) = std_select(
+                    is_signed(ngTensorType) ? sgt(val, curr) : ugt(val, curr), val, curr);
+            }
+        });
+
+        rewriter.replaceOp(op, result);
+    }
+
+    Value createTanh(Value x)
+    {
+        Type elemTy = x.getType();
+        if (!elemTy.cast<FloatType>().isF32())
+        {
+            // tanh(x) = sign(x) * (1 - exp(-2|x|)) / (1 + exp(-2|x|)) never overflows
+            Value zero = createZeroConstant(elemTy);
+            Value one = createOneConstant(elemTy);
+            Value isNeg = slt(x, zero);
+            Value absX = std_select(isNeg, zero - x, x);
+            Value e = ValueBuilder<ExpOp>(createFloatConstant(-2.0, elemTy) * absX);
+            Value t = (one - e) / (one + e);
+            return std_select(isNeg, zero - t, t);
+        }
+
+        // Same 13/6-degree rational approximation as Eigen's single precision tanh used by
+        // the CPU kernels. The input is clamped to the range where it is not exactly +/-1 and
+        // tiny inputs return x itself.
+        Value clamp = createFloatConstant(7.90531110763549805, elemTy);
+        Value negClamp = createFloatConstant(-7.90531110763549805, elemTy);
+        Value tiny = createFloatConstant(0.0004, elemTy);
+        Value zero = createZeroConstant(elemTy);
+
+        Value clamped = std_select(sgt(x, clamp), clamp, x);
+        clamped = std_select(slt(clamped, negClamp), negClamp, clamped);
+        Value absX = std_select(slt(x, zero), zero - x, x);
+        Value x2 = clamped * clamped;
+
+        static const double alpha[] = {4.89352455891786e-03,
+                                       6.37261928875436e-04,
+                                       1.48572235717979e-05,
+                                       5.12229709037114e-08,
+                                       -8.60467152213735e-11,
+                                       2.00018790482477e-13,
+                                       -2.76076847742355e-16};
+        static const double beta[] = {4.89352518554385e-03,
+                                      2.26843463243900e-03,
+                                      1.18534705686654e-04,
+                                      1.19825839466702e-06};
+        Value p = createFloatConstant(alpha[6], elemTy);
+        for (int i = 5; i >= 0; i--)
+        {
+            p = p * x2 + createFloatConstant(alpha[i], elemTy);
+        }
+        p = p * clamped;
+        Value q = createFloatConstant(beta[3], elemTy);
+        for (int i = 2; i >= 0; i--)
+        {
+            q = q * x2 + createFloatConstant(beta[i], elemTy);
+        }
+        return std_select(slt(absX, tiny), x, p / q);
+    }
+
+    Value createPow(Value lhs, Value rhs)
+    {
+        // lhs^rhs = exp(rhs * log(|lhs|)), then fix up the sign for negative bases. A
+        // negative base with a non-integral exponent is NaN, matching std::pow.
+        Type elemTy = lhs.getType();
+        Value zero = createZeroConstant(elemTy);
+        Value one = createOneConstant(elemTy);
+        Value isNeg = slt(lhs, zero);
+        Value absLHS = std_select(isNeg, zero - lhs, lhs);
+        Value mag = ValueBuilder<ExpOp>(rhs * ValueBuilder<LogOp>(absLHS));
+
+        auto i64Ty = IntegerType::get(64, elemTy.getContext());
+        Value intRHS = ValueBuilder<FPToSIOp>(rhs, i64Ty);
+        Value isIntegral = eq(ValueBuilder<SIToFPOp>(intRHS, elemTy), rhs);
+        Value isOdd = ne(ValueBuilder<AndOp>(intRHS, std_constant_int(1, 64)),
+                         std_constant_int(0, 64));
+        Value nan = std_constant_float(
+            llvm::APFloat::getNaN(elemTy.cast<FloatType>().getFloatSemantics()),
+            elemTy.cast<FloatType>());
+        Value negResult = std_select(isIntegral, std_select(isOdd, zero - mag, mag), nan);
+        Value res = std_select(isNeg, negResult, mag);
+        // x^0 is 1 for every x, including 0 and NaN
+        return std_select(eq(rhs, zero), one, res);
+    }
+
+    Value createConvert(Value val, Type dstTy, bool isSignedSrc)
+    {
+        Type srcTy = val.getType();
+        if (srcTy == dstTy)
+        {
+            return val;
+        }
+        auto srcFloatTy = srcTy.dyn_cast<FloatType>();
+        auto dstFloatTy = dstTy.dyn_cast<FloatType>();
+        if (srcFloatTy && dstFloatTy)
+        {
+            return srcFloatTy.getWidth() < dstFloatTy.getWidth()
+                       ? Value(ValueBuilder<FPExtOp>(val, dstTy))
+                       : Value(ValueBuilder<FPTruncOp>(val, dstTy));
+        }
+        if (dstFloatTy)
+        {
+            NGRAPH_CHECK(isSignedSrc, "Unsigned to floating-point conversion is not supported");
+            return ValueBuilder<SIToFPOp>(val, dstTy);
+        }
+        if (srcFloatTy)
+        {
+            return ValueBuilder<FPToSIOp>(val, dstTy);
+        }
+        unsigned srcWidth = srcTy.cast<IntegerType>().getWidth();
+        unsigned dstWidth = dstTy.cast<IntegerType>().getWidth();
+        if (srcWidth > dstWidth)
+        {
+            return ValueBuilder<TruncateIOp>(val, dstTy);
+        }
+        if (srcWidth < dstWidth)
+        {
+            return isSignedSrc ? Value(ValueBuilder<SignExtendIOp>(val, dstTy))
+                               : Value(ValueBuilder<ZeroExtendIOp>(val, dstTy));
+        }
+        // Same width, only the signedness differs
+        return val;
+    }
+
+    Value createFloatConstant(double value, mlir::Type type)
+    {
+        auto floatTy = type.cast<FloatType>();
+        bool losesInfo = false;
+        llvm::APFloat apValue(value);
+        apValue.convert(
+            floatTy.getFloatSemantics(), llvm::APFloat::rmNearestTiesToEven, &losesInfo);
+        return std_constant_float(apValue, floatTy);
+    }
+
     Value createZeroConstant(mlir::Type type)
     {
         if (auto floatTy = type.dyn_cast<FloatType>())
@@ -2998,7 +3438,7 @@ namespace
             }
             else if (floatTy.isF64())
             {
-                return std_constant_float(llvm::APFloat(1.0f), floatTy);
+                return std_constant_float(llvm::APFloat(1.0), floatTy);
             }
             else
             {
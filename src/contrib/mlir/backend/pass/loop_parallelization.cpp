@@ -0,0 +1,426 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#include "loop_parallelization.hpp"
+
+#include <algorithm>
+#include <llvm/ADT/SetVector.h>
+#include <llvm/Support/Debug.h>
+#include <mlir/Analysis/Utils.h>
+#include <mlir/Conversion/VectorToLLVM/ConvertVectorToLLVM.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/LLVMIR/LLVMDialect.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/Dialect/Vector/VectorOps.h>
+#include <mlir/IR/BlockAndValueMapping.h>
+#include <mlir/IR/Function.h>
+#include <mlir/IR/Module.h>
+#include <mlir/Transforms/DialectConversion.h>
+#include <mlir/Transforms/RegionUtils.h>
+
+#define DEBUG_TYPE "ngraph-loop-parallelization"
+
+using namespace mlir;
+
+// Prefix of the functions created for outlined loop bodies. The dispatch lowering finds
+// the call sites to rewrite by this prefix since custom attributes do not survive the
+// conversion to the LLVM dialect.
+static const char kParallelBodyPrefix[] = "__ngraph_parallel_body_";
+static const char kParallelForCallback[] = "__ngraph_parallel_for";
+// Function attribute of an outlined body holding the estimated cost of one iteration. Unlike
+// call site attributes, function attributes are kept by the conversion to LLVM.
+static const char kIterationCostAttr[] = "ngraph.iteration_cost";
+
+// Rough number of operations run by one iteration of `forOp`. The body of a nested loop with
+// constant bounds counts once per iteration of that loop.
+static int64_t estimateIterationCost(AffineForOp forOp)
+{
+    int64_t cost = 0;
+    for (auto& op : forOp.getBody()->without_terminator())
+    {
+        auto inner = dyn_cast<AffineForOp>(op);
+        if (!inner)
+        {
+            cost++;
+            continue;
+        }
+        int64_t trips = 1;
+        if (inner.hasConstantBounds())
+        {
+            int64_t step = inner.getStep();
+            trips = (inner.getConstantUpperBound() - inner.getConstantLowerBound() + step - 1) /
+                    step;
+        }
+        cost += std::max<int64_t>(trips, 1) * estimateIterationCost(inner);
+    }
+    return std::max<int64_t>(cost, 1);
+}
+
+namespace
+{
+    class AffineParallelOutliningPass
+        : public PassWrapper<AffineParallelOutliningPass, OperationPass<ModuleOp>>
+    {
+    public:
+        void getDependentDialects(DialectRegistry& registry) const override
+        {
+            registry.insert<AffineDialect, StandardOpsDialect>();
+        }
+
+    private:
+        void runOnOperation() override;
+        void outline(AffineForOp forOp, StringRef name);
+    };
+
+    class ParallelDispatchLoweringPass
+        : public PassWrapper<ParallelDispatchLoweringPass, OperationPass<ModuleOp>>
+    {
+    public:
+        void getDependentDialects(DialectRegistry& registry) const override
+        {
+            registry.insert<LLVM::LLVMDialect>();
+        }
+
+    private:
+        void runOnOperation() override;
+        LLVM::LLVMFuncOp getOrCreateTaskFunc(LLVM::LLVMFuncOp body,
+                                             LLVM::LLVMType frameTy,
+                                             ArrayRef<LLVM::LLVMType> capturedTys);
+    };
+
+    class LowerToLLVMWithVectorsPass
+        : public PassWrapper<LowerToLLVMWithVectorsPass, OperationPass<ModuleOp>>
+    {
+    public:
+        LowerToLLVMWithVectorsPass(const LowerToLLVMOptions& options)
+            : m_options(options)
+        {
+        }
+
+        void getDependentDialects(DialectRegistry& registry) const override
+        {
+            registry.insert<LLVM::LLVMDialect>();
+        }
+
+    private:
+        void runOnOperation() override;
+
+        LowerToLLVMOptions m_options;
+    };
+}
+
+void AffineParallelOutliningPass::runOnOperation()
+{
+    auto module = getOperation();
+
+    // Collect first: outlining adds functions to the module
+    SmallVector<AffineForOp, 8> candidates;
+    for (auto func : module.getOps<FuncOp>())
+    {
+        if (func.isExternal() || func.getName().startswith(kParallelBodyPrefix))
+        {
+            continue;
+        }
+        for (auto forOp : func.getBody().front().getOps<AffineForOp>())
+        {
+            if (!forOp.hasConstantBounds() || !isLoopParallel(forOp))
+            {
+                continue;
+            }
+            auto tripCount = forOp.getConstantUpperBound() - forOp.getConstantLowerBound();
+            if (tripCount < 2 * forOp.getStep())
+            {
+                continue;
+            }
+            candidates.push_back(forOp);
+        }
+    }
+
+    unsigned counter = 0;
+    for (auto forOp : candidates)
+    {
+        outline(forOp, (kParallelBodyPrefix + std::to_string(counter++)));
+    }
+}
+
+void AffineParallelOutliningPass::outline(AffineForOp forOp, StringRef name)
+{
+    auto module = getOperation();
+    auto loc = forOp.getLoc();
+    auto* context = module.getContext();
+    int64_t lowerBound = forOp.getConstantLowerBound();
+    int64_t step = forOp.getStep();
+    int64_t tripCount = (forOp.getConstantUpperBound() - lowerBound + step - 1) / step;
+
+    // Constants are rematerialized in the outlined body, everything else is passed in
+    llvm::SetVector<Value> usedAbove;
+    getUsedValuesDefinedAbove(forOp.getLoopBody(), usedAbove);
+    SmallVector<Value, 8> captured;
+    SmallVector<Operation*, 8> constants;
+    for (auto value : usedAbove)
+    {
+        auto def = value.getDefiningOp();
+        if (def && isa<ConstantOp>(def))
+        {
+            constants.push_back(def);
+        }
+        else
+        {
+            captured.push_back(value);
+        }
+    }
+
+    // func @name(%first: index, %last: index, captured...)
+    SmallVector<Type, 8> argTypes{IndexType::get(context), IndexType::get(context)};
+    for (auto value : captured)
+    {
+        argTypes.push_back(value.getType());
+    }
+    auto funcTy = FunctionType::get(argTypes, {}, context);
+    auto outlined = FuncOp::create(loc, name, funcTy);
+    int64_t iterationCost = estimateIterationCost(forOp);
+    outlined.setAttr(kIterationCostAttr, OpBuilder(context).getI64IntegerAttr(iterationCost));
+    module.push_back(outlined);
+
+    auto* entry = outlined.addEntryBlock();
+    auto builder = OpBuilder::atBlockEnd(entry);
+    BlockAndValueMapping mapping;
+    for (auto constant : constants)
+    {
+        builder.clone(*constant, mapping);
+    }
+    for (unsigned i = 0; i < captured.size(); i++)
+    {
+        mapping.map(captured[i], entry->getArgument(i + 2));
+    }
+
+    // The outlined loop walks iteration numbers; the original induction variable is
+    // recovered as lowerBound + iteration * step
+    auto symbolMap = builder.getSymbolIdentityMap();
+    auto newFor = builder.create<AffineForOp>(loc,
+                                              ValueRange{entry->getArgument(0)},
+                                              symbolMap,
+                                              ValueRange{entry->getArgument(1)},
+                                              symbolMap,
+                                              1);
+    auto bodyBuilder = OpBuilder::atBlockTerminator(newFor.getBody());
+    auto ivMap =
+        AffineMap::get(1, 0, builder.getAffineDimExpr(0) * step + lowerBound, context);
+    auto iv = bodyBuilder.create<AffineApplyOp>(loc, ivMap, newFor.getInductionVar());
+    mapping.map(forOp.getInductionVar(), iv.getResult());
+    for (auto& op : forOp.getBody()->without_terminator())
+    {
+        bodyBuilder.clone(op, mapping);
+    }
+    builder.create<ReturnOp>(loc);
+
+    // Replace the loop with a call covering the whole iteration space
+    OpBuilder callBuilder(forOp);
+    SmallVector<Value, 8> operands{callBuilder.create<ConstantIndexOp>(loc, 0),
+                                   callBuilder.create<ConstantIndexOp>(loc, tripCount)};
+    operands.append(captured.begin(), captured.end());
+    callBuilder.create<CallOp>(loc, outlined, operands);
+    forOp.erase();
+
+    LLVM_DEBUG(llvm::dbgs() << "Outlined parallel loop with " << tripCount
+                            << " iterations of cost " << iterationCost << " into " << name
+                            << "\n");
+}
+
+LLVM::LLVMFuncOp
+    ParallelDispatchLoweringPass::getOrCreateTaskFunc(LLVM::LLVMFuncOp body,
+                                                      LLVM::LLVMType frameTy,
+                                                      ArrayRef<LLVM::LLVMType> capturedTys)
+{
+    auto module = getOperation();
+    auto taskName = (body.getName() + "_task").str();
+    if (auto task = module.lookupSymbol<LLVM::LLVMFuncOp>(taskName))
+    {
+        return task;
+    }
+
+    // void task(i64 first, i64 last, i8* frame) unpacks the frame and calls the body
+    auto* context = module.getContext();
+    auto loc = body.getLoc();
+    auto llvmI32Ty = LLVM::LLVMType::getInt32Ty(context);
+    auto llvmI64Ty = LLVM::LLVMType::getInt64Ty(context);
+    auto llvmI8PtrTy = LLVM::LLVMType::getInt8PtrTy(context);
+    auto taskTy = LLVM::LLVMType::getFunctionTy(
+        LLVM::LLVMType::getVoidTy(context), {llvmI64Ty, llvmI64Ty, llvmI8PtrTy}, false);
+
+    OpBuilder builder(module.getBody()->getTerminator());
+    auto task = builder.create<LLVM::LLVMFuncOp>(loc, taskName, taskTy);
+    auto* entry = task.addEntryBlock();
+    builder.setInsertionPointToStart(entry);
+
+    auto frame =
+        builder.create<LLVM::BitcastOp>(loc, frameTy.getPointerTo(), entry->getArgument(2));
+    auto zero = builder.create<LLVM::ConstantOp>(loc, llvmI32Ty, builder.getI32IntegerAttr(0));
+    SmallVector<Value, 8> args{entry->getArgument(0), entry->getArgument(1)};
+    for (unsigned i = 0; i < capturedTys.size(); i++)
+    {
+        auto index = builder.create<LLVM::ConstantOp>(loc, llvmI32Ty, builder.getI32IntegerAttr(i));
+        auto field = builder.create<LLVM::GEPOp>(
+            loc, capturedTys[i].getPointerTo(), frame, ArrayRef<Value>({zero, index}));
+        args.push_back(builder.create<LLVM::LoadOp>(loc, field));
+    }
+    builder.create<LLVM::CallOp>(
+        loc,
+        TypeRange(),
+        args,
+        ArrayRef<NamedAttribute>{
+            builder.getNamedAttr("callee", builder.getSymbolRefAttr(body.getName()))});
+    builder.create<LLVM::ReturnOp>(loc, ValueRange());
+    return task;
+}
+
+void ParallelDispatchLoweringPass::runOnOperation()
+{
+    auto module = getOperation();
+    auto* context = module.getContext();
+
+    SmallVector<LLVM::CallOp, 8> calls;
+    module.walk([&](LLVM::CallOp call) {
+        auto callee = call.callee();
+        if (callee && callee->startswith(kParallelBodyPrefix))
+        {
+            calls.push_back(call);
+        }
+    });
+    if (calls.empty())
+    {
+        return;
+    }
+
+    auto llvmI32Ty = LLVM::LLVMType::getInt32Ty(context);
+    auto llvmI64Ty = LLVM::LLVMType::getInt64Ty(context);
+    auto llvmI8PtrTy = LLVM::LLVMType::getInt8PtrTy(context);
+
+    // void __ngraph_parallel_for(i8* task, i64 first, i64 last, i8* frame, i64 cost)
+    auto callback = module.lookupSymbol<LLVM::LLVMFuncOp>(kParallelForCallback);
+    if (!callback)
+    {
+        OpBuilder builder(module.getBody()->getTerminator());
+        auto callbackTy = LLVM::LLVMType::getFunctionTy(
+            LLVM::LLVMType::getVoidTy(context),
+            {llvmI8PtrTy, llvmI64Ty, llvmI64Ty, llvmI8PtrTy, llvmI64Ty},
+            false);
+        callback =
+            builder.create<LLVM::LLVMFuncOp>(module.getLoc(), kParallelForCallback, callbackTy);
+    }
+
+    for (auto call : calls)
+    {
+        auto loc = call.getLoc();
+        auto body = module.lookupSymbol<LLVM::LLVMFuncOp>(*call.callee());
+        auto operands = call.getOperands();
+
+        SmallVector<LLVM::LLVMType, 8> capturedTys;
+        for (auto operand : operands.drop_front(2))
+        {
+            capturedTys.push_back(operand.getType().cast<LLVM::LLVMType>());
+        }
+        auto frameTy = LLVM::LLVMType::getStructTy(context, capturedTys);
+        auto task = getOrCreateTaskFunc(body, frameTy, capturedTys);
+
+        // Spill the captured values into a stack frame the task function reads back
+        OpBuilder builder(call);
+        auto one = builder.create<LLVM::ConstantOp>(loc, llvmI64Ty, builder.getI64IntegerAttr(1));
+        auto frame = builder.create<LLVM::AllocaOp>(loc, frameTy.getPointerTo(), one, 0);
+        auto zero = builder.create<LLVM::ConstantOp>(loc, llvmI32Ty, builder.getI32IntegerAttr(0));
+        for (unsigned i = 0; i < capturedTys.size(); i++)
+        {
+            auto index =
+                builder.create<LLVM::ConstantOp>(loc, llvmI32Ty, builder.getI32IntegerAttr(i));
+            auto field = builder.create<LLVM::GEPOp>(
+                loc, capturedTys[i].getPointerTo(), frame, ArrayRef<Value>({zero, index}));
+            builder.create<LLVM::StoreOp>(loc, operands[i + 2], field);
+        }
+
+        int64_t iterationCost = 1;
+        if (auto costAttr = body.getAttrOfType<IntegerAttr>(kIterationCostAttr))
+        {
+            iterationCost = costAttr.getInt();
+        }
+        auto cost = builder.create<LLVM::ConstantOp>(
+            loc, llvmI64Ty, builder.getI64IntegerAttr(iterationCost));
+
+        auto taskAddr = builder.create<LLVM::AddressOfOp>(loc, task);
+        auto taskPtr = builder.create<LLVM::BitcastOp>(loc, llvmI8PtrTy, taskAddr);
+        auto framePtr = builder.create<LLVM::BitcastOp>(loc, llvmI8PtrTy, frame);
+        builder.create<LLVM::CallOp>(
+            loc,
+            TypeRange(),
+            ValueRange{taskPtr, operands[0], operands[1], framePtr, cost},
+            ArrayRef<NamedAttribute>{
+                builder.getNamedAttr("callee", builder.getSymbolRefAttr(callback))});
+        call.erase();
+    }
+}
+
+void LowerToLLVMWithVectorsPass::runOnOperation()
+{
+    auto module = getOperation();
+    LLVMTypeConverter typeConverter(&getContext(), m_options);
+
+    OwningRewritePatternList patterns;
+    populateVectorToLLVMConversionPatterns(typeConverter, patterns);
+    if (m_options.useBarePtrCallConv)
+    {
+        populateStdToLLVMBarePtrConversionPatterns(typeConverter, patterns);
+    }
+    else
+    {
+        populateStdToLLVMConversionPatterns(typeConverter, patterns);
+    }
+
+    LLVMConversionTarget target(getContext());
+    if (failed(applyPartialConversion(module, target, std::move(patterns))))
+    {
+        signalPassFailure();
+    }
+}
+
+namespace mlir
+{
+    std::unique_ptr<Pass> createAffineParallelOutliningPass()
+    {
+        return std::make_unique<AffineParallelOutliningPass>();
+    }
+
+    std::unique_ptr<Pass> createParallelDispatchLoweringPass()
+    {
+        return std::make_unique<ParallelDispatchLoweringPass>();
+    }
+
+    std::unique_ptr<Pass> createLowerToLLVMWithVectorsPass(const LowerToLLVMOptions& options)
+    {
+        return std::make_unique<LowerToLLVMWithVectorsPass>(options);
+    }
+}
+
+static PassRegistration<AffineParallelOutliningPass>
+    outliningPass("ngraph-affine-parallel-outlining",
+                  "Outline outermost parallel affine loops for thread pool dispatch");
+
+static PassRegistration<ParallelDispatchLoweringPass>
+    dispatchPass("ngraph-parallel-dispatch-lowering",
+                 "Dispatch outlined parallel loops through __ngraph_parallel_for");
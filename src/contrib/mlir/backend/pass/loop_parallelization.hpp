@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#pragma once
+
+#include <mlir/Conversion/StandardToLLVM/ConvertStandardToLLVM.h>
+#include <mlir/Pass/Pass.h>
+
+namespace mlir
+{
+    /// Outlines the body of every outermost parallel affine.for into its own function
+    /// taking the iteration range to run and the values the loop captures. The loop is
+    /// replaced by a call covering its whole iteration space. The estimated cost of one
+    /// iteration is recorded on the outlined function.
+    std::unique_ptr<Pass> createAffineParallelOutliningPass();
+
+    /// Runs on the LLVM dialect. Replaces the calls created by the outlining pass with a
+    /// call to the `__ngraph_parallel_for` runtime callback, which splits the iteration
+    /// range over the CPU backend's thread pool, sized by the recorded iteration cost.
+    /// Captured values are passed through a stack frame unpacked by a generated task
+    /// function.
+    std::unique_ptr<Pass> createParallelDispatchLoweringPass();
+
+    /// Standard to LLVM dialect lowering that also lowers the vector dialect ops produced
+    /// by affine super-vectorization.
+    std::unique_ptr<Pass> createLowerToLLVMWithVectorsPass(const LowerToLLVMOptions& options);
+}
@@ -94,10 +94,49 @@ static mlir::LogicalResult verifyBinaryArithOp(T op)
     return verifyCompatibleOperandsAndResults(op);
 }
 
+/// Convert changes the element type only
+template <>
+mlir::LogicalResult verifyUnaryArithOp(NGConvertOp op)
+{
+    NGTensorType argType = op.arg().getType().cast<NGTensorType>();
+    NGTensorType resType = op.getOperation()->getResult(0).getType().cast<NGTensorType>();
+    if (!resType.isCompatibleShape(argType))
+        return op.emitOpError("Incompatible result shape for convert op");
+    return mlir::success();
+}
+
 template <typename T>
 static mlir::LogicalResult verifyAxisReductionOp(T op)
 {
-    return mlir::failure();
+    NGTensorType operandType = op.operand().getType().template cast<NGTensorType>();
+    NGTensorType resType =
+        op.getOperation()->getResult(0).getType().template cast<NGTensorType>();
+    auto operandShape = operandType.getShape();
+
+    SmallVector<bool, 4> reduced(operandShape.size(), false);
+    for (auto attr : op.axes())
+    {
+        int64_t axis = attr.template cast<IntegerAttr>().getInt();
+        if (axis < 0 || axis >= operandType.getRank())
+            return op.emitOpError("Reduction axis is out of range");
+        reduced[axis] = true;
+    }
+
+    // Reduced axes are removed from the result shape
+    SmallVector<int64_t, 4> expectedShape;
+    for (unsigned i = 0; i < operandShape.size(); i++)
+    {
+        if (!reduced[i])
+        {
+            expectedShape.push_back(operandShape[i]);
+        }
+    }
+    if (resType.getShape() != ArrayRef<int64_t>(expectedShape))
+        return op.emitOpError("Incompatible result shape for reduction op");
+    if (resType.getElementType() != operandType.getElementType())
+        return op.emitOpError("Incompatible result type for reduction op");
+
+    return mlir::success();
 }
 
 template <typename T>
@@ -150,8 +189,12 @@ mlir::LogicalResult verifyOp(NGSelectOp op)
     // arg1 arg2 of same shape and elt type
     if (!opType1.isCompatible(opType2))
         return op.emitOpError("Incompatible operand shapes or types for select op");
-    // arg0 of same shape and elt type is bool
-    if (!opType0.isCompatibleShape(opType1) || !opType0.getElementType().isa<NGBoolType>())
+    // arg0 of same shape and elt type is bool. nGraph booleans are imported as u8.
+    Type predEltType = opType0.getElementType();
+    bool isBoolPred = predEltType.isa<NGBoolType>() ||
+                      (predEltType.isa<NGIntegerType>() &&
+                       predEltType.cast<NGIntegerType>().isUnsignedInteger(8));
+    if (!opType0.isCompatibleShape(opType1) || !isBoolPred)
         return op.emitOpError("Incompatible shape for arg0 of select op");
     // result is of same shape and elt type as arg1/2
     if (!resType.isCompatible(opType1))
@@ -185,6 +228,44 @@ static mlir::LogicalResult verifyCmpOp(T op)
     return mlir::success();
 }
 
+template <>
+mlir::LogicalResult verifyOp(NGBroadcastOp op)
+{
+    NGTensorType argType = op.arg().getType().cast<NGTensorType>();
+    NGTensorType resType = op.getOperation()->getResult(0).getType().cast<NGTensorType>();
+    auto resShape = resType.getShape();
+
+    // Every result axis is either a broadcast axis or maps to the next argument axis
+    auto axisSet = op.axisSet();
+    if (argType.getRank() + axisSet.size() != resShape.size())
+        return op.emitOpError("Incompatible result rank for broadcast op");
+    for (auto attr : axisSet)
+    {
+        int64_t axis = attr.cast<IntegerAttr>().getInt();
+        if (axis < 0 || axis >= static_cast<int64_t>(resShape.size()))
+            return op.emitOpError("Broadcast axis is out of range");
+    }
+    if (resType.getElementType() != argType.getElementType())
+        return op.emitOpError("Incompatible result type for broadcast op");
+
+    return mlir::success();
+}
+
+template <>
+mlir::LogicalResult verifyOp(NGReshapeOp op)
+{
+    NGTensorType argType = op.arg().getType().cast<NGTensorType>();
+    NGTensorType resType = op.getOperation()->getResult(0).getType().cast<NGTensorType>();
+
+    if (op.axisOrder().size() != static_cast<size_t>(argType.getRank()))
+        return op.emitOpError("Axis order must be a permutation of the argument axes");
+    if (resType.getNumElements() != argType.getNumElements() ||
+        resType.getElementType() != argType.getElementType())
+        return op.emitOpError("Incompatible result shape or type for reshape op");
+
+    return mlir::success();
+}
+
 template <>
 mlir::LogicalResult verifyOp(NGGatherOp op)
 {
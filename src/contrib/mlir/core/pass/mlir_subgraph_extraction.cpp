@@ -497,6 +497,43 @@ bool MLIRSubgraphExtractionPass::is_supported_mlir_op(std::shared_ptr<Node> node
         return true;
     }
 
+    // Transcendental ops are lowered to floating point math only
+    if (is_type<ngraph::op::v0::Exp>(node) || is_type<ngraph::op::v0::Log>(node) ||
+        is_type<ngraph::op::v0::Sqrt>(node) || is_type<ngraph::op::v0::Tanh>(node) ||
+        is_type<ngraph::op::v0::Sigmoid>(node))
+    {
+        return node->get_input_element_type(0).is_real();
+    }
+
+    if (is_type<ngraph::op::v1::Power>(node))
+    {
+        // No implicit broadcasting in the lowering
+        return node->get_input_element_type(0).is_real() &&
+               node->get_input_shape(0) == node->get_input_shape(1);
+    }
+
+    if (auto convert = as_type_ptr<ngraph::op::v0::Convert>(node))
+    {
+        auto src_type = node->get_input_element_type(0);
+        auto dst_type = convert->get_destination_type();
+        // There is no unsigned integer to floating point cast in the standard dialect
+        if (dst_type.is_real() && !src_type.is_real())
+        {
+            return src_type.is_signed() && src_type != element::boolean;
+        }
+        return true;
+    }
+
+    if (auto sum = as_type_ptr<ngraph::op::v0::Sum>(node))
+    {
+        return sum->reduction_axes_constant();
+    }
+
+    if (auto max = as_type_ptr<ngraph::op::v0::Max>(node))
+    {
+        return max->reduction_axes_constant();
+    }
+
     // Dot is 2D only
     if (is_type<ngraph::op::v0::Dot>(node))
     {
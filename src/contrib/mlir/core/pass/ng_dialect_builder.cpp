@@ -104,6 +104,9 @@ namespace
         template <typename RedOp>
         mlir::Operation* createIndexReduction(const ngraph::Node* ngNode);
 
+        template <typename RedOp>
+        mlir::Operation* createAxisReduction(const ngraph::Node* ngNode);
+
         void createReturn();
 
         /// Converts nGraph shape-like types \p ng_shape to MLIR shape \p mlir_shape.
@@ -474,6 +477,108 @@ mlir::Operation*
     return NgDialectObj.createGenericOp<mlir::NGAbsOp>(ngNode);
 }
 
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Exp>(NgDialectConversionPass& NgDialectObj,
+                                                           const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGExpOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Log>(NgDialectConversionPass& NgDialectObj,
+                                                           const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGLogOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Sqrt>(NgDialectConversionPass& NgDialectObj,
+                                                            const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGSqrtOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Tanh>(NgDialectConversionPass& NgDialectObj,
+                                                            const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGTanhOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::createOp<ngraph::op::v0::Sigmoid>(
+    NgDialectConversionPass& NgDialectObj, const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGSigmoidOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::createOp<ngraph::op::v0::Convert>(
+    NgDialectConversionPass& NgDialectObj, const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGConvertOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v1::Power>(NgDialectConversionPass& NgDialectObj,
+                                                             const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGPowOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Select>(NgDialectConversionPass& NgDialectObj,
+                                                              const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createGenericOp<mlir::NGSelectOp>(ngNode);
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::createOp<ngraph::op::v0::Broadcast>(
+    NgDialectConversionPass& NgDialectObj, const ngraph::Node* ngNode)
+{
+    auto broadcast = static_cast<const ngraph::op::v0::Broadcast*>(ngNode);
+    auto op = NgDialectObj.createGenericOp<mlir::NGBroadcastOp>(ngNode);
+    auto broadcastOp = llvm::cast<mlir::NGBroadcastOp>(op);
+    broadcastOp.setShape(NgDialectObj.getShapeAsAttr(broadcast->get_broadcast_shape()));
+    broadcastOp.setAxisSet(NgDialectObj.getShapeAsAttr(broadcast->get_broadcast_axes()));
+    return op;
+}
+
+template <>
+mlir::Operation* NgDialectConversionPass::createOp<ngraph::op::v0::Reshape>(
+    NgDialectConversionPass& NgDialectObj, const ngraph::Node* ngNode)
+{
+    auto reshape = static_cast<const ngraph::op::v0::Reshape*>(ngNode);
+    auto op = NgDialectObj.createGenericOp<mlir::NGReshapeOp>(ngNode);
+    auto reshapeOp = llvm::cast<mlir::NGReshapeOp>(op);
+    reshapeOp.setAxisOrder(NgDialectObj.getShapeAsAttr(reshape->get_input_order()));
+    reshapeOp.setShape(NgDialectObj.getShapeAsAttr(reshape->get_reshape_output_shape()));
+    return op;
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Sum>(NgDialectConversionPass& NgDialectObj,
+                                                           const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGSumRedOp>(ngNode);
+}
+
+template <>
+mlir::Operation*
+    NgDialectConversionPass::createOp<ngraph::op::v0::Max>(NgDialectConversionPass& NgDialectObj,
+                                                           const ngraph::Node* ngNode)
+{
+    return NgDialectObj.createAxisReduction<mlir::NGMaxRedOp>(ngNode);
+}
+
 template <>
 mlir::Operation* NgDialectConversionPass::createOp<ngraph::op::v0::Convolution>(
     NgDialectConversionPass& NgDialectObj, const ngraph::Node* ngNode)
@@ -736,6 +841,16 @@ mlir::Operation* NgDialectConversionPass::createIndexReduction(const ngraph::Nod
     return op;
 }
 
+template <typename RedOp>
+mlir::Operation* NgDialectConversionPass::createAxisReduction(const ngraph::Node* ngNode)
+{
+    auto* arithRed = static_cast<const ngraph::op::util::ArithmeticReduction*>(ngNode);
+    // The reduction axes are a constant second input folded into an attribute
+    auto op = createGenericOp<RedOp>(ngNode, 1);
+    op->setAttr("axes", getShapeAsAttr(arithRed->get_reduction_axes()));
+    return op;
+}
+
 std::unique_ptr<mlir::Pass>
     ngraph::pass::createNgDialectConversionPass(std::shared_ptr<ngraph::Function> function,
                                                 mlir::MLIRContext* context)
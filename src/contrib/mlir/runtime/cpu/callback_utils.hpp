@@ -24,6 +24,10 @@ namespace ngraph
     {
         namespace ngmlir
         {
+            // Thread pool arena __ngraph_parallel_for dispatches to from the calling thread.
+            // MLIRCPURuntime::run_in_arena sets it for the duration of a call.
+            extern thread_local int parallelForArena;
+
             // OpType class is used for callbacks.
             // We pass OpType to the generic callback functions,
             // which call the real implementation based on OpType.
@@ -23,6 +23,7 @@
 #include "cpu_runtime.hpp"
 #include "ngraph/check.hpp"
 
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 
@@ -1032,3 +1033,28 @@ extern "C" void _mlir_ciface_callback_3_inputs(
         NGRAPH_UNREACHABLE("Unsupported type");
     }
 }
+
+thread_local int ngraph::runtime::ngmlir::parallelForArena = 0;
+
+// Runs task(first, last, frame) over chunks of [begin, end) on the thread pool arena of the
+// calling CPU runtime context. Called by code generated for loops outlined by the parallel
+// outlining pass; `cost` is the estimated number of operations per iteration.
+extern "C" void __ngraph_parallel_for(
+    void* task, int64_t begin, int64_t end, void* frame, int64_t cost)
+{
+    using TaskFn = void (*)(int64_t, int64_t, void*);
+    auto taskFn = reinterpret_cast<TaskFn>(task);
+    if (end - begin < 2)
+    {
+        taskFn(begin, end, frame);
+        return;
+    }
+
+    auto& device =
+        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(parallelForArena);
+    device.parallelFor(end - begin,
+                       Eigen::TensorOpCost(0, 0, cost),
+                       [&](Eigen::Index first, Eigen::Index last) {
+                           taskFn(begin + first, begin + last, frame);
+                       });
+}
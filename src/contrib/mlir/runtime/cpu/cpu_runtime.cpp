@@ -19,16 +19,30 @@
 // convention.
 
 #include "cpu_runtime.hpp"
+#include "callback_utils.hpp"
 #include "contrib/mlir/backend/cpu/cpu_backend.hpp"
 #include "ngraph/check.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
 
+#include <algorithm>
 #include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringMap.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/IR/Module.h>
 #include <llvm/Support/CommandLine.h>
 #include <llvm/Support/ErrorOr.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MD5.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
@@ -63,141 +77,269 @@ llvm::cl::opt<bool> clEnableBarePtrMemRefLowering(
     llvm::cl::init(false),
     llvm::cl::desc("Enable the lowering of MemRefs to LLVM bare pointers"));
 
+MLIRCPURuntime::MLIRCPURuntime()
+    : m_mainFunction(nullptr)
+{
+}
+
+MLIRCPURuntime::~MLIRCPURuntime()
+{
+}
+
+void MLIRCPURuntime::compile()
+{
+    std::call_once(m_compileFlag, [this]() { compile_internal(); });
+}
+
 void MLIRCPURuntime::run(const std::vector<MemRefArg>& args, bool firstIteration)
 {
-    run_internal(args, firstIteration);
+    (void)firstIteration;
+    compile();
+
+    // Invoke the JIT-compiled function with the arguments. Note that, for API
+    // uniformity reasons, it takes a list of type-erased pointers to arguments.
+    auto invokeArgs = bindArguments(args);
+    m_mainFunction(invokeArgs.data());
+    cleanup(invokeArgs);
+}
+
+void MLIRCPURuntime::run_in_arena(const std::vector<MemRefArg>& args, int arena)
+{
+    int previousArena = parallelForArena;
+    parallelForArena = arena;
+    try
+    {
+        run(args, false);
+    }
+    catch (...)
+    {
+        parallelForArena = previousArena;
+        throw;
+    }
+    parallelForArena = previousArena;
 }
 
-void MLIRCPURuntime::run_internal(const std::vector<MemRefArg>& args, bool firstIteration)
+void MLIRCPURuntime::compile_internal()
 {
-    // Create an MLIR execution engine. We use a null MLIR pass manager for now to
-    // make sure we
-    // don't run MLIR passes that were already run. We also pass a default
-    // transformer created with
-    // the default or user-provided optimization level.
+    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
 
-    if (!m_engine)
+    auto mainName = clEnableBarePtrMemRefLowering ? "main" : "_mlir_ciface_main";
+    auto dumpFilename =
+        clObjectFilename.empty() ? std::string("jitted_mlir.o") : clObjectFilename.getValue();
+    std::string cachePath = getObjectCachePath();
+
+    if (!cachePath.empty() && loadCachedObject(cachePath))
+    {
+        NGRAPH_DEBUG << "Loaded MLIR object from " << cachePath;
+        m_mainFunction = lookupPackedFunction(mainName);
+        if (clDumpObjectFile)
+        {
+            llvm::sys::fs::copy_file(cachePath, dumpFilename);
+        }
+    }
+    else
     {
+        // Create an MLIR execution engine. We use a null MLIR pass manager for now to
+        // make sure we
+        // don't run MLIR passes that were already run. We also pass a default
+        // transformer created with
+        // the default or user-provided optimization level.
         auto llvmTransformer = mlir::makeOptimizingTransformer(
             MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
         auto maybeEngine = mlir::ExecutionEngine::create(
             m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
         NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
         m_engine = std::move(maybeEngine.get());
+
+        // The lookup triggers the actual code generation
+        m_mainFunction = lookupPackedFunction(mainName);
+        if (!cachePath.empty())
+        {
+            // Write to a private file first so that concurrent processes never read a
+            // partially written object
+            std::string tmpPath =
+                cachePath + ".tmp" + std::to_string(llvm::sys::Process::getProcessId());
+            m_engine->dumpToObjectFile(tmpPath);
+            if (llvm::sys::fs::rename(tmpPath, cachePath))
+            {
+                NGRAPH_DEBUG << "Failed to save MLIR object to " << cachePath;
+                llvm::sys::fs::remove(tmpPath);
+            }
+        }
+        if (clDumpObjectFile)
+        {
+            m_engine->dumpToObjectFile(dumpFilename);
+        }
     }
 
-    bindArguments(args);
-    execute(firstIteration);
-    cleanup();
+    if (!clEnableBarePtrMemRefLowering)
+    {
+        // Attributes used by callbacks are stored in module globals by this function
+        lookupPackedFunction("_mlir_ciface_callback_init")(nullptr);
+    }
 }
 
-// Binds MLIR function arguments to the proper values. This includes externally
-// allocated tensors
-// helpers to be used inside the function.
-void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
+std::string MLIRCPURuntime::getObjectCachePath()
 {
-    NGRAPH_CHECK(m_module, "MLIR module is not ready.");
+    static const std::string cacheDir = getenv_string("NGRAPH_MLIR_OBJECT_CACHE_DIR");
+    if (cacheDir.empty())
+    {
+        return "";
+    }
+    if (llvm::sys::fs::create_directories(cacheDir))
+    {
+        NGRAPH_DEBUG << "Cannot create MLIR object cache directory " << cacheDir;
+        return "";
+    }
+
+    // The object depends on the module, on everything that affects code generation and on
+    // the CPU it was generated for, since the JIT targets the host.
+    std::string moduleText;
+    llvm::raw_string_ostream moduleStream(moduleText);
+    m_module->print(moduleStream);
+    moduleStream.flush();
+
+    std::vector<std::string> features;
+    llvm::StringMap<bool> hostFeatures;
+    if (llvm::sys::getHostCPUFeatures(hostFeatures))
+    {
+        for (auto& feature : hostFeatures)
+        {
+            features.push_back((feature.second ? "+" : "-") + feature.first().str());
+        }
+    }
+    std::sort(features.begin(), features.end());
 
-    auto name = clEnableBarePtrMemRefLowering ? "main" : "_mlir_ciface_main";
-    auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>(name);
-    NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
+    llvm::MD5 hash;
+    hash.update(moduleText);
+    hash.update(LLVM_VERSION_STRING);
+    hash.update(llvm::sys::getProcessTriple());
+    hash.update(llvm::sys::getHostCPUName());
+    for (auto& feature : features)
+    {
+        hash.update(feature);
+    }
+    hash.update(std::to_string(static_cast<int>(MLIRCPUBackend::mlirOptLevel)));
+    hash.update(clEnableBarePtrMemRefLowering ? "bare-ptr" : "memref-desc");
+    llvm::MD5::MD5Result result;
+    hash.final(result);
+    llvm::SmallString<32> digest;
+    llvm::MD5::stringifyResult(result, digest);
+
+    llvm::SmallString<128> path(cacheDir);
+    llvm::sys::path::append(path, "ngraph_mlir_" + digest.str().str() + ".o");
+    return path.str().str();
+}
+
+bool MLIRCPURuntime::loadCachedObject(const std::string& path)
+{
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer)
+    {
+        return false;
+    }
+
+    auto maybeJit = llvm::orc::LLJITBuilder().create();
+    if (!maybeJit)
+    {
+        llvm::consumeError(maybeJit.takeError());
+        return false;
+    }
+    std::unique_ptr<llvm::orc::LLJIT> jit = std::move(*maybeJit);
+
+    // Callbacks into the CPU backend are resolved against the running process, like the
+    // execution engine does
+    auto generator = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+        jit->getDataLayout().getGlobalPrefix());
+    if (!generator)
+    {
+        llvm::consumeError(generator.takeError());
+        return false;
+    }
+    jit->getMainJITDylib().addGenerator(std::move(*generator));
 
-    // Set external arguments
-    m_externalTensors = &args;
+    if (auto err = jit->addObjectFile(std::move(*buffer)))
+    {
+        NGRAPH_DEBUG << "Ignoring unusable MLIR object " << path << ": "
+                     << llvm::toString(std::move(err));
+        return false;
+    }
+    m_cachedJit = std::move(jit);
+    return true;
+}
 
+MLIRCPURuntime::PackedFunction MLIRCPURuntime::lookupPackedFunction(StringRef name)
+{
+    if (m_engine)
+    {
+        auto expectedFunction = m_engine->lookup(name);
+        NGRAPH_CHECK(expectedFunction,
+                     "JIT lookup of '",
+                     name.str(),
+                     "' failed: ",
+                     llvm::toString(expectedFunction.takeError()));
+        return *expectedFunction;
+    }
+
+    // The execution engine adds the packed-argument wrappers before code generation, so
+    // they are part of the cached object as well.
+    auto symbol = m_cachedJit->lookup(("_mlir_" + name).str());
+    NGRAPH_CHECK(symbol,
+                 "Lookup of '",
+                 name.str(),
+                 "' in the cached MLIR object failed: ",
+                 llvm::toString(symbol.takeError()));
+    return reinterpret_cast<PackedFunction>(symbol->getAddress());
+}
+
+// Binds MLIR function arguments to the proper values. This includes externally
+// allocated tensors
+// helpers to be used inside the function.
+SmallVector<void*, 8> MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
+{
     // Create list with a type-erased double pointer for each invocation
     // arguments.
     // We currently use 'allocateMemrefArgs', which creates the arguments list per
     // call ABI (see
     // comment below).
     // StaticMemRef is just a struct with the actual pointer to the data.
+    auto invokeArgs = allocateMemrefArgs(args);
+    NGRAPH_CHECK(invokeArgs.size(), "Arguments can't be created");
 
-    for (auto i = 0; i < m_externalTensors->size(); i++)
-    {
-        m_ranks.push_back((*m_externalTensors)[i].m_shape.size());
-    }
-    auto expectedArguments = allocateMemrefArgs();
-    NGRAPH_CHECK(expectedArguments.size(), "Arguments can't be created");
-    m_invokeArgs = std::move(expectedArguments);
-
-    NGRAPH_CHECK(m_invokeArgs.size() == m_externalTensors->size(),
+    NGRAPH_CHECK(invokeArgs.size() == args.size(),
                  "Number of external tensors doesn't match number of function arguments");
 
     // Assign external tensor pointers to invocation arguments.
-    for (size_t i = 0, numArgs = m_invokeArgs.size(); i < numArgs; ++i)
+    for (size_t i = 0, numArgs = invokeArgs.size(); i < numArgs; ++i)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
             // Default memref lowering lowers memrefs to StaticMemRef descriptors.
-            auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(m_invokeArgs[i]));
-            memRefArg->allocatedPtr = (*m_externalTensors)[i].m_tensor;
-            memRefArg->alignedPtr = (*m_externalTensors)[i].m_tensor;
-            auto rank = m_ranks[i];
+            auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(invokeArgs[i]));
+            memRefArg->allocatedPtr = args[i].m_tensor;
+            memRefArg->alignedPtr = args[i].m_tensor;
+            auto rank = args[i].m_shape.size();
             for (auto j = 0; j < rank; j++)
             {
-                memRefArg->shapeAndStrides[j] = (*m_externalTensors)[i].m_shape[j];
-                memRefArg->shapeAndStrides[rank + j] = (*m_externalTensors)[i].m_strides[j];
+                memRefArg->shapeAndStrides[j] = args[i].m_shape[j];
+                memRefArg->shapeAndStrides[rank + j] = args[i].m_strides[j];
             }
         }
         else
         {
             // Custom memref lowering lowers memref arguments to bare pointers to
             // tensors.
-            auto** memRefArg = reinterpret_cast<void**>(m_invokeArgs[i]);
-            *memRefArg = (*m_externalTensors)[i].m_tensor;
-        }
-    }
-}
-
-// Lowers standard dialect to LLVM dialect and uses the MLIR execution engine to
-// execute the code.
-void MLIRCPURuntime::execute(bool firstIteration)
-{
-    // Invoke the JIT-compiled function with the arguments. Note that, for API
-    // uniformity reasons, it takes a list of type-erased pointers to arguments.
-    // Please, note that 'invoke' method is overloaded with a parameter pack
-    // version.
-    // Make sure the MutableArrayRef version is invoked.
-    if (!clEnableBarePtrMemRefLowering)
-    {
-        if (firstIteration)
-        {
-            auto invocationResult = m_engine->invoke("_mlir_ciface_callback_init");
-            if (clDumpObjectFile)
-            {
-                m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                    : clObjectFilename.getValue());
-            }
-            NGRAPH_CHECK(!invocationResult,
-                         "JIT invocation of '_mlir_ciface_callback_init' failed\n");
-        }
-
-        auto invocationResult =
-            m_engine->invoke("_mlir_ciface_main", llvm::MutableArrayRef<void*>(m_invokeArgs));
-        if (clDumpObjectFile)
-        {
-            m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                : clObjectFilename.getValue());
-        }
-        NGRAPH_CHECK(!invocationResult, "JIT invocation of '_mlir_ciface_main' failed\n");
-    }
-    else
-    {
-        auto invocationResult =
-            m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
-        if (clDumpObjectFile)
-        {
-            m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                : clObjectFilename.getValue());
+            auto** memRefArg = reinterpret_cast<void**>(invokeArgs[i]);
+            *memRefArg = args[i].m_tensor;
         }
-        NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
     }
+    return invokeArgs;
 }
 
-void MLIRCPURuntime::cleanup()
+void MLIRCPURuntime::cleanup(SmallVector<void*, 8>& invokeArgs)
 {
     // Free void double pointer arguments without freeing external tensor data.
-    for (auto* arg : m_invokeArgs)
+    for (auto* arg : invokeArgs)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
@@ -233,15 +375,15 @@ void MLIRCPURuntime::cleanup()
 //   arg0Ptr-> <data>
 //   arg1Ptr-> <data>
 //   ...
-SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs()
+SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs(const std::vector<MemRefArg>& externalArgs)
 {
     SmallVector<void*, 8> args;
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    for (auto i = 0; i < externalArgs.size(); i++)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
             // Default memref lowering lowers memrefs to StaticMemRef descriptors.
-            auto descriptor = allocateDefaultMemrefDescriptor(m_ranks[i]);
+            auto descriptor = allocateDefaultMemrefDescriptor(externalArgs[i].m_shape.size());
             StaticMemRef** arg = reinterpret_cast<StaticMemRef**>(malloc(sizeof(StaticMemRef*)));
             *arg = descriptor;
             args.push_back(arg);
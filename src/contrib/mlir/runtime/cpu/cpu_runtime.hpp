@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <mlir/ExecutionEngine/ExecutionEngine.h>
 #include <mlir/IR/Builders.h>
 #include <mlir/IR/Module.h>
@@ -28,6 +29,14 @@
 #include "contrib/mlir/backend/backend.hpp"
 #include "contrib/mlir/runtime/runtime.hpp"
 
+namespace llvm
+{
+    namespace orc
+    {
+        class LLJIT;
+    }
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -52,23 +61,47 @@ namespace ngraph
             /// The module should be in LLVM dialect and ready to be lowered via an MLIR
             /// ExecutionEngine. The runtime owns the context and must out-live any MLIR
             /// code Compilation and execution.
+            ///
+            /// Once compiled, `run` does not modify the runtime, so a single runtime can be
+            /// shared by every CPU runtime context executing the same CompiledKernel.
             class MLIRCPURuntime : public MLIRRuntime
             {
             public:
-                /// Executes a pre-compiled subgraph
+                MLIRCPURuntime();
+                ~MLIRCPURuntime();
+
+                /// JIT-compiles the module and runs its one-time initialization. When
+                /// NGRAPH_MLIR_OBJECT_CACHE_DIR is set, the object code is looked up in and
+                /// saved to that directory, keyed by the module and the host CPU. Only the
+                /// first call does any work.
+                void compile();
+                /// Executes a pre-compiled subgraph, compiling it first if needed.
+                /// `firstIteration` is kept for interface compatibility; initialization is
+                /// done by `compile`.
                 void run(const std::vector<MemRefArg>& args, bool firstIteration) override;
+                /// Executes like `run`, dispatching parallel loops to thread pool arena `arena`
+                /// of the CPU executor.
+                void run_in_arena(const std::vector<MemRefArg>& args, int arena);
 
             private:
-                void run_internal(const std::vector<MemRefArg>& args, bool firstIteration);
+                using PackedFunction = void (*)(void**);
+
+                void compile_internal();
+                // Returns the path of the cached object for this module, or an empty string
+                // when the on-disk cache is disabled.
+                std::string getObjectCachePath();
+                // Loads a previously cached object. Returns false if it is missing or stale.
+                bool loadCachedObject(const std::string& path);
+                // Looks up the packed-argument wrapper of function `name`
+                PackedFunction lookupPackedFunction(llvm::StringRef name);
+
                 // Bind external tensors to MLIR module entry point
-                void bindArguments(const std::vector<MemRefArg>& args);
-                // Invokes an MLIR module entry point with bound arguments
-                void execute(bool firstIteration);
+                llvm::SmallVector<void*, 8> bindArguments(const std::vector<MemRefArg>& args);
                 // Cleans up allocated args
-                void cleanup();
+                void cleanup(llvm::SmallVector<void*, 8>& invokeArgs);
 
                 /// Helper to create memref arguments for MLIR function signature
-                llvm::SmallVector<void*, 8> allocateMemrefArgs();
+                llvm::SmallVector<void*, 8> allocateMemrefArgs(const std::vector<MemRefArg>& args);
 
                 /// Helper to allocate a default MemRef descriptor for LLVM. Handles static
                 /// shapes
@@ -76,13 +109,11 @@ namespace ngraph
                 StaticMemRef* allocateDefaultMemrefDescriptor(size_t);
 
             private:
-                // Pointers to externally allocated memory for sub-graph's input and output
-                // tensors.
-                const std::vector<MemRefArg>* m_externalTensors;
-                // Arguments for the MLIR function generated for the nGraph sub-graph.
-                llvm::SmallVector<void*, 8> m_invokeArgs;
+                std::once_flag m_compileFlag;
                 std::unique_ptr<::mlir::ExecutionEngine> m_engine;
-                std::vector<size_t> m_ranks;
+                // JIT holding an object loaded from the on-disk cache instead of m_engine
+                std::unique_ptr<llvm::orc::LLJIT> m_cachedJit;
+                PackedFunction m_mainFunction;
             };
         }
     }
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <limits>
+
+#include "ngraph/autodiff/loss_scaling.hpp"
+#include "ngraph/op/all.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/greater_equal.hpp"
+#include "ngraph/op/less_equal.hpp"
+#include "ngraph/op/logical_and.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+autodiff::Adjoints autodiff::make_scaled_adjoints(const Output<Node>& loss,
+                                                  const Output<Node>& scale)
+{
+    const Shape& loss_shape = loss.get_shape();
+    AxisSet broadcast_axes;
+    for (size_t i = 0; i < loss_shape.size(); ++i)
+    {
+        broadcast_axes.insert(i);
+    }
+    auto seed = make_shared<op::v0::Broadcast>(scale, loss_shape, broadcast_axes);
+    return Adjoints(OutputVector{loss}, OutputVector{seed});
+}
+
+OutputVector autodiff::unscale_gradients(const OutputVector& gradients,
+                                         const Output<Node>& scale)
+{
+    OutputVector result;
+    Output<Node> finite;
+    for (auto& gradient : gradients)
+    {
+        auto unscaled = make_shared<op::v1::Divide>(gradient, scale);
+        result.push_back(unscaled);
+
+        // Compare against the largest finite value rather than relying on NaN semantics,
+        // which fast-math builds are free to assume away. NaN fails both comparisons.
+        Output<Node> value = gradient;
+        if (value.get_element_type() != element::f32)
+        {
+            value = make_shared<op::v0::Convert>(value, element::f32);
+        }
+        const float largest = numeric_limits<float>::max();
+        auto upper = op::v0::Constant::create(element::f32, Shape{}, {largest});
+        auto lower = op::v0::Constant::create(element::f32, Shape{}, {-largest});
+        auto in_range =
+            make_shared<op::v1::LogicalAnd>(make_shared<op::v1::GreaterEqual>(value, lower),
+                                            make_shared<op::v1::LessEqual>(value, upper));
+        AxisSet all_axes;
+        for (size_t i = 0; i < gradient.get_shape().size(); ++i)
+        {
+            all_axes.insert(i);
+        }
+        Output<Node> all_in_range = make_shared<op::v0::All>(in_range, all_axes);
+        finite = finite.get_node() ? make_shared<op::v1::LogicalAnd>(finite, all_in_range)
+                                   : all_in_range;
+    }
+
+    if (finite.get_node())
+    {
+        result.push_back(finite);
+    }
+    else
+    {
+        result.push_back(op::v0::Constant::create(element::boolean, Shape{}, {1}));
+    }
+    return result;
+}
+
+autodiff::DynamicLossScaler::DynamicLossScaler(float initial_scale,
+                                               float growth_factor,
+                                               float backoff_factor,
+                                               size_t growth_interval)
+    : m_scale(initial_scale)
+    , m_growth_factor(growth_factor)
+    , m_backoff_factor(backoff_factor)
+    , m_growth_interval(growth_interval)
+{
+}
+
+bool autodiff::DynamicLossScaler::update(bool gradients_finite)
+{
+    if (!gradients_finite)
+    {
+        m_scale *= m_backoff_factor;
+        m_finite_steps = 0;
+        return false;
+    }
+
+    if (++m_finite_steps >= m_growth_interval)
+    {
+        m_scale *= m_growth_factor;
+        m_finite_steps = 0;
+    }
+    return true;
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace autodiff
+    {
+        /// \brief Sets up backprop of `loss` seeded with `scale` rather than one.
+        ///
+        /// Multiplying the loss gradient keeps small gradients representable when the
+        /// backward pass runs in a low precision type (see pass::MixedPrecision).
+        ///
+        /// \param loss The value being minimized.
+        /// \param scale An f32 scalar holding the current loss scale. Passing it as a Parameter
+        ///              lets the scale change between steps without recompiling.
+        NGRAPH_API
+        Adjoints make_scaled_adjoints(const Output<Node>& loss, const Output<Node>& scale);
+
+        /// \brief Divides each gradient by `scale` and checks them for overflow.
+        ///
+        /// \return The unscaled gradients, in order, followed by a boolean scalar which is
+        ///         false if any gradient element is NaN or infinite.
+        NGRAPH_API
+        OutputVector unscale_gradients(const OutputVector& gradients, const Output<Node>& scale);
+
+        /// \brief Host side loss scale schedule for mixed precision training.
+        ///
+        /// The scale is multiplied by `backoff_factor` on every step that overflowed and by
+        /// `growth_factor` after `growth_interval` consecutive finite steps.
+        class NGRAPH_API DynamicLossScaler
+        {
+        public:
+            DynamicLossScaler(float initial_scale = 65536.0f,
+                              float growth_factor = 2.0f,
+                              float backoff_factor = 0.5f,
+                              size_t growth_interval = 2000);
+
+            float get_scale() const { return m_scale; }
+            /// \brief Records the overflow flag produced by unscale_gradients for one step.
+            ///
+            /// \return true if the step's gradients may be applied to the weights.
+            bool update(bool gradients_finite);
+
+        private:
+            float m_scale;
+            float m_growth_factor;
+            float m_backoff_factor;
+            size_t m_growth_interval;
+            size_t m_finite_steps{0};
+        };
+    }
+}
@@ -233,6 +233,8 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a constant that shares the data of other. Clones of a
+                ///        Constant are made this way, so cloning never copies the payload.
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -26,6 +26,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
@@ -76,6 +77,95 @@ namespace
         return true;
     }
 
+    bool is_whole(const Output<Node>& arg,
+                  const Coordinate& lower_bounds,
+                  const Coordinate& upper_bounds,
+                  const Strides& strides)
+    {
+        const Shape& shape = arg.get_shape();
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            if (lower_bounds[i] != 0 || upper_bounds[i] != shape[i] || strides[i] != 1)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns the value of arg[lower_bounds:upper_bounds:strides], computed from the sources of
+    // arg where it is a slice or a concat
+    Output<Node> fold_slice(const Output<Node>& arg,
+                            const Coordinate& lower_bounds,
+                            const Coordinate& upper_bounds,
+                            const Strides& strides)
+    {
+        if (is_whole(arg, lower_bounds, upper_bounds, strides))
+        {
+            return arg;
+        }
+
+        if (auto slice = as_type_ptr<op::v0::Slice>(arg.get_node_shared_ptr()))
+        {
+            // Element i of this slice is element lower + (l + i * s) * stride of the source
+            const Coordinate& inner_lower = slice->get_lower_bounds();
+            const Strides& inner_strides = slice->get_strides();
+            Coordinate lower(lower_bounds.size());
+            Coordinate upper(lower_bounds.size());
+            Strides merged_strides(lower_bounds.size());
+            for (size_t i = 0; i < lower_bounds.size(); i++)
+            {
+                size_t count =
+                    (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                lower[i] = inner_lower[i] + lower_bounds[i] * inner_strides[i];
+                merged_strides[i] = inner_strides[i] * strides[i];
+                upper[i] = count == 0 ? lower[i] : lower[i] + (count - 1) * merged_strides[i] + 1;
+            }
+            return fold_slice(slice->input_value(0), lower, upper, merged_strides);
+        }
+
+        if (auto concat = as_type_ptr<op::v0::Concat>(arg.get_node_shared_ptr()))
+        {
+            size_t axis = concat->get_concatenation_axis();
+            OutputVector parts;
+            bool pushed_slice = false;
+            size_t offset = 0;
+            for (auto& input : concat->input_values())
+            {
+                size_t end = offset + input.get_shape()[axis];
+                if (offset <= lower_bounds[axis] && upper_bounds[axis] <= end)
+                {
+                    // Within a single input, whatever the stride
+                    Coordinate lower = lower_bounds;
+                    Coordinate upper = upper_bounds;
+                    lower[axis] -= offset;
+                    upper[axis] -= offset;
+                    return fold_slice(input, lower, upper, strides);
+                }
+                if (strides[axis] == 1 && lower_bounds[axis] < end && offset < upper_bounds[axis])
+                {
+                    Coordinate lower = lower_bounds;
+                    Coordinate upper = upper_bounds;
+                    lower[axis] = std::max(lower_bounds[axis], offset) - offset;
+                    upper[axis] = std::min(upper_bounds[axis], end) - offset;
+                    auto part = fold_slice(input, lower, upper, strides);
+                    pushed_slice = pushed_slice || is_type<op::v0::Slice>(part.get_node());
+                    parts.push_back(part);
+                }
+                offset = end;
+            }
+            // Pushing slices above a concat copies as much as the slice did, and saves the
+            // concat copy only if nothing else reads the concat
+            if (!parts.empty() && (arg.get_target_inputs().size() == 1 || !pushed_slice))
+            {
+                return std::make_shared<op::v0::Concat>(parts, axis)->output(0);
+            }
+        }
+
+        return std::make_shared<op::v0::Slice>(arg, lower_bounds, upper_bounds, strides)
+            ->output(0);
+    }
+
     std::vector<size_t> get_concatenation_axis_vector(const NodeVector& bounded_concat_ops)
     {
         std::vector<size_t> concat_axis_vec;
@@ -277,3 +367,36 @@ bool ngraph::pass::SelfConcatFusion::replace_patterns(const NodeVector& bounded_
     replace_node(last_bounded_concat_op, broadcast);
     return true;
 }
+
+bool ngraph::pass::ConcatSliceFusion::run_on_function(std::shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto slice = as_type_ptr<op::v0::Slice>(node);
+        if (!slice)
+        {
+            continue;
+        }
+        auto arg = slice->input_value(0);
+        auto source = arg.get_node_shared_ptr();
+        if (!is_type<op::v0::Slice>(source) && !is_type<op::v0::Concat>(source))
+        {
+            continue;
+        }
+
+        auto folded = fold_slice(
+            arg, slice->get_lower_bounds(), slice->get_upper_bounds(), slice->get_strides());
+        auto folded_slice = as_type<op::v0::Slice>(folded.get_node());
+        if (folded_slice && folded_slice->input_value(0) == arg)
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "concat_slice_fusion: folded " << slice->get_name() << " into "
+                     << folded.get_node()->get_name();
+        slice->output(0).replace(folded);
+        modified = true;
+    }
+    return modified;
+}
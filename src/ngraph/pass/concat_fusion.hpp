@@ -28,6 +28,7 @@ namespace ngraph
     {
         class ConcatElimination;
         class SelfConcatFusion;
+        class ConcatSliceFusion;
     }
 }
 
@@ -59,3 +60,20 @@ private:
     bool replace_patterns(const NodeVector&);
     std::vector<NodeVector> m_concat_pattern_vectors;
 };
+
+/// \brief Folds slices of concats and of other slices, so that tensors concatenated only to be
+///        sliced (or split) apart again are read from their sources instead.
+///
+/// For each `Slice`:
+///  - a slice of a slice becomes a single slice of the source;
+///  - a slice of a concat that stays within one concat input becomes a slice of that input, or
+///    the input itself if it is taken whole;
+///  - a slice of a concat that spans several inputs becomes a concat of the slices of those
+///    inputs, if nothing else reads the original concat or none of the pushed slices remains
+///    (the range is aligned with the concat boundaries).
+class NGRAPH_API ngraph::pass::ConcatSliceFusion : public ngraph::pass::FunctionPass
+{
+public:
+    ConcatSliceFusion() { set_property(PassProperty::REQUIRE_STATIC_SHAPE, true); }
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/mixed_precision.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pass::MixedPrecision::is_low_precision_safe(const Node& node)
+{
+    return is_type<op::v0::Dot>(&node) || is_type<op::v0::MatMul>(&node) ||
+           is_type<op::v0::Convolution>(&node) || is_type<op::v1::Convolution>(&node) ||
+           is_type<op::v0::ConvolutionBackpropData>(&node) ||
+           is_type<op::v1::ConvolutionBackpropData>(&node) ||
+           is_type<op::v0::ConvolutionBackpropFilters>(&node) ||
+           is_type<op::v1::ConvolutionBackpropFilters>(&node) || is_type<op::v0::Relu>(&node) ||
+           is_type<op::v0::ReluBackprop>(&node) || is_type<op::v0::MaxPool>(&node) ||
+           is_type<op::v1::MaxPool>(&node) || is_type<op::v0::AvgPool>(&node) ||
+           is_type<op::v1::AvgPool>(&node) || is_type<op::v0::Reshape>(&node) ||
+           is_type<op::v1::Reshape>(&node);
+}
+
+// Returns the low precision value `output` was widened from, if `output` is such a Convert.
+static Output<Node> get_narrow_source(const Output<Node>& output,
+                                      const element::Type& low_precision_type)
+{
+    auto convert = as_type_ptr<op::v0::Convert>(output.get_node_shared_ptr());
+    if (convert && convert->get_input_element_type(0) == low_precision_type)
+    {
+        return convert->input_value(0);
+    }
+    return Output<Node>();
+}
+
+bool pass::MixedPrecision::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto n : f->get_ordered_ops())
+    {
+        if (n->get_output_size() != 1 || n->get_output_element_type(0) != element::f32 ||
+            !is_low_precision_safe(*n))
+        {
+            continue;
+        }
+
+        // Integer inputs (shapes, axes) are passed through; any other real type is left alone
+        bool mixed_real_types = false;
+        for (auto& input : n->inputs())
+        {
+            if (input.get_element_type().is_real() && input.get_element_type() != element::f32)
+            {
+                mixed_real_types = true;
+                break;
+            }
+        }
+        if (mixed_real_types)
+        {
+            continue;
+        }
+
+        OutputVector new_args;
+        for (auto& value : n->input_values())
+        {
+            if (value.get_element_type() != element::f32)
+            {
+                new_args.push_back(value);
+                continue;
+            }
+            // Reuse the low precision producer directly instead of narrowing a widened value
+            auto narrow = get_narrow_source(value, m_low_precision_type);
+            if (narrow.get_node())
+            {
+                new_args.push_back(narrow);
+            }
+            else
+            {
+                new_args.push_back(make_shared<op::v0::Convert>(value, m_low_precision_type));
+            }
+        }
+
+        auto low_precision_node = n->clone_with_new_inputs(new_args);
+        if (m_is_supported && !m_is_supported(*low_precision_node))
+        {
+            NGRAPH_DEBUG << "MixedPrecision: backend does not support " << n->get_name()
+                         << " in " << m_low_precision_type;
+            continue;
+        }
+        auto widen = make_shared<op::v0::Convert>(low_precision_node, element::f32);
+        NGRAPH_DEBUG << "MixedPrecision: computing " << n->get_name() << " in "
+                     << m_low_precision_type;
+        replace_node(n, widen);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MixedPrecision;
+    }
+}
+
+/// \brief Runs the numerically safe parts of an f32 training graph in a lower precision.
+///
+/// Ops that accumulate internally in f32 (Dot, MatMul, the Convolution family) and ops that
+/// only move or select values (Relu, pooling, Reshape) are computed in the low precision type.
+/// Each such op gets Convert nodes on its inputs and a Convert back to f32 on its output.
+/// Back-to-back casts between two low precision ops are cancelled, so a chain of eligible ops
+/// only converts at its boundaries. Parameters are never touched, which keeps the master
+/// weights and the optimizer update in f32. Reductions, normalizations and transcendental
+/// functions are left in f32.
+///
+/// The Convert nodes remain separate kernels; they are not fused into their neighbours.
+/// When a backend query is given, an op is only narrowed if the backend reports that it can
+/// compute the low precision version; everything else stays in f32.
+class NGRAPH_API ngraph::pass::MixedPrecision : public FunctionPass
+{
+public:
+    /// \brief Function signature type for callback used to check whether the backend supports
+    ///        the low precision version of a node.
+    using op_query_t = std::function<bool(const Node& node)>;
+
+    MixedPrecision(const element::Type& low_precision_type = element::bf16,
+                   op_query_t is_supported = nullptr)
+        : FunctionPass()
+        , m_low_precision_type(low_precision_type)
+        , m_is_supported(is_supported)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \return true if `node` is computed in the low precision type by this pass.
+    static bool is_low_precision_safe(const Node& node);
+
+private:
+    element::Type m_low_precision_type;
+    op_query_t m_is_supported;
+};
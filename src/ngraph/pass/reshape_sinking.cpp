@@ -17,6 +17,7 @@
 #include "reshape_sinking.hpp"
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <set>
 #include <unordered_set>
@@ -27,12 +28,18 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/pad.hpp"
+#include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/pattern/op/label.hpp"
@@ -141,6 +148,212 @@ static AxisSet get_quantization_axes_in_default_order(shared_ptr<op::v0::Reshape
     return axis_set;
 }
 
+// compute the reduction axes in the order of the reduction's actual input, and the order
+// its reduced output is left in
+static AxisSet get_reduction_axes_in_default_order(const AxisVector& order,
+                                                   const AxisSet& old_axis_set,
+                                                   AxisVector& reduced_order)
+{
+    AxisSet axis_set;
+    for (auto axis : old_axis_set)
+    {
+        axis_set.insert(order.at(axis));
+    }
+    // position of every remaining input axis in the reduced output
+    vector<size_t> positions(order.size(), 0);
+    size_t position = 0;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (axis_set.count(i) == 0)
+        {
+            positions.at(i) = position++;
+        }
+    }
+    reduced_order.clear();
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (old_axis_set.count(i) == 0)
+        {
+            reduced_order.push_back(positions.at(order.at(i)));
+        }
+    }
+    return axis_set;
+}
+
+// a reorder that only moves axes of extent 1 does not move any data
+static bool is_trivial_order(const AxisVector& order, const Shape& output_shape)
+{
+    bool first = true;
+    size_t last = 0;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (output_shape.at(i) == 1)
+        {
+            continue;
+        }
+        if (!first && order.at(i) < last)
+        {
+            return false;
+        }
+        first = false;
+        last = order.at(i);
+    }
+    return true;
+}
+
+static bool is_sinkable_reduction(shared_ptr<Node> n)
+{
+    return (is_type<op::v0::Sum>(n) || is_type<op::v0::Product>(n) || is_type<op::v0::Max>(n) ||
+            is_type<op::v0::Min>(n)) &&
+           static_pointer_cast<op::util::ArithmeticReduction>(n)->reduction_axes_constant();
+}
+
+// implicitly broadcasting binaries can't be reordered
+static bool is_sinkable_binary(shared_ptr<Node> n)
+{
+    return n->is_binary_elementwise_arithmetic() &&
+           n->get_input_shape(0) == n->get_output_shape(0) &&
+           n->get_input_shape(1) == n->get_output_shape(0);
+}
+
+static bool has_pending_order(const Output<Node>& value,
+                              const AxisVector& order,
+                              const ReshapeMap& reorders)
+{
+    auto node = value.get_node_shared_ptr();
+    auto it = reorders.find(node);
+    if (it != reorders.end())
+    {
+        return it->second->get_input_order() == order;
+    }
+    // not processed yet, this is a guess
+    auto reshape = as_type_ptr<op::v0::Reshape>(node);
+    return reshape && reshape->get_input_order() == order;
+}
+
+// Cost model. Costs are the number of elements transposed by the reshapes a decision is
+// expected to leave in the graph. Looking ahead is bounded, past the horizon every user is
+// assumed to materialize.
+static const size_t max_lookahead = 8;
+static const size_t cannot_sink = numeric_limits<size_t>::max();
+
+static size_t sinking_cost(shared_ptr<Node> n,
+                           const AxisVector& order,
+                           const ReshapeMap& reorders,
+                           size_t depth);
+
+// cost of sinking a reorder pending on the given input past its node
+static size_t sink_through_cost(const Input<Node>& input,
+                                const AxisVector& order,
+                                const ReshapeMap& reorders,
+                                size_t depth)
+{
+    auto n = input.get_node()->shared_from_this();
+    if (input.get_index() == 0 &&
+        (n->is_unary_elementwise_arithmetic() || is_type<op::v0::Quantize>(n) ||
+         is_type<op::v0::Dequantize>(n) || is_type<op::v0::Slice>(n) || is_type<op::v0::Pad>(n)))
+    {
+        return sinking_cost(n, order, reorders, depth + 1);
+    }
+    else if (input.get_index() == 0 && is_sinkable_reduction(n))
+    {
+        AxisVector reduced_order;
+        get_reduction_axes_in_default_order(
+            order,
+            static_pointer_cast<op::util::ArithmeticReduction>(n)->get_reduction_axes(),
+            reduced_order);
+        return sinking_cost(n, reduced_order, reorders, depth + 1);
+    }
+    else if (is_sinkable_binary(n))
+    {
+        // the other operand is swum up to its producers unless it's reordered the same way
+        auto other = n->input_value(1 - input.get_index());
+        size_t cost = 0;
+        if (!has_pending_order(other, order, reorders) &&
+            !is_type<op::v0::Constant>(other.get_node()) &&
+            !is_type<op::v0::Broadcast>(other.get_node()))
+        {
+            cost = shape_size(other.get_shape());
+        }
+        return cost + sinking_cost(n, order, reorders, depth + 1);
+    }
+    else if (is_type<op::v0::Concat>(n))
+    {
+        for (auto value : n->input_values())
+        {
+            if (value != input.get_source_output() && !has_pending_order(value, order, reorders))
+            {
+                return cannot_sink;
+            }
+        }
+        return sinking_cost(n, order, reorders, depth + 1);
+    }
+    return cannot_sink;
+}
+
+static size_t sinking_cost(shared_ptr<Node> n,
+                           const AxisVector& order,
+                           const ReshapeMap& reorders,
+                           size_t depth)
+{
+    const auto& shape = n->get_output_shape(0);
+    if (is_trivial_order(order, shape))
+    {
+        return 0;
+    }
+    auto users = n->output(0).get_target_inputs();
+    size_t size = shape_size(shape);
+    if (depth > max_lookahead)
+    {
+        return size * users.size();
+    }
+    size_t cost = 0;
+    for (auto input : users)
+    {
+        auto reshape = as_type_ptr<op::v0::Reshape>(input.get_node()->shared_from_this());
+        if (reshape && reshape->get_is_transpose() &&
+            reshape->get_output_shape(0).size() == order.size())
+        {
+            // combined with the reorder, it doesn't add a transpose
+            continue;
+        }
+        cost += min(size, sink_through_cost(input, order, reorders, depth));
+    }
+    return cost;
+}
+
+// A reorder pending on an input of n is sunk past n if the transposes expected downstream
+// move no more data than materializing it here
+static bool is_sinking_profitable(shared_ptr<Node> n, const ReshapeMap& reorders)
+{
+    for (auto input : n->inputs())
+    {
+        auto arg_reshape = reorders.at(input.get_source_output().get_node_shared_ptr());
+        auto order = arg_reshape->get_input_order();
+        if (!is_trivial_order(order, arg_reshape->get_output_shape(0)))
+        {
+            return sink_through_cost(input, order, reorders, 0) <=
+                   shape_size(arg_reshape->get_output_shape(0));
+        }
+    }
+    return true;
+}
+
+static size_t count_transposes(shared_ptr<Function> f)
+{
+    size_t count = 0;
+    for (auto n : f->get_ops())
+    {
+        auto reshape = as_type_ptr<op::v0::Reshape>(n);
+        if (reshape && reshape->get_is_transpose() &&
+            !is_trivial_order(reshape->get_input_order(), reshape->get_output_shape(0)))
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
 struct Swimmer
 {
     Input<Node> input;
@@ -226,7 +439,7 @@ void swim(Input<Node> input, shared_ptr<op::v0::Reshape> reshape)
                 AxisVector new_source_axes_sorted{new_source_axes};
                 sort(new_source_axes_sorted.begin(), new_source_axes_sorted.end());
                 map<size_t, size_t> old_new_source_axes;
-                for (size_t i = 0; new_source_axes_sorted.size(); i++)
+                for (size_t i = 0; i < new_source_axes_sorted.size(); i++)
                 {
                     old_new_source_axes.insert({new_source_axes.at(i), i});
                 }
@@ -285,12 +498,6 @@ static void materialize_shapes(shared_ptr<Node> n,
                                ReshapeMap& reorders,
                                set<shared_ptr<Node>>& reshapes_to_delete)
 {
-    // skip multiple output nodes and deal with GOEs exclusively
-    if (n->get_output_size() > 1)
-    {
-        return;
-    }
-
     for (size_t i = 0; i < n->get_arguments().size(); i++)
     {
         // materialize all pending reshapes, flush pending reshapes
@@ -310,7 +517,11 @@ static void materialize_shapes(shared_ptr<Node> n,
             // no swimming up
         }
     }
-    write_reshapemap(reorders, n, create_default_reshape(n));
+    // outputs of multiple output nodes aren't tracked, their users materialize
+    if (n->get_output_size() == 1)
+    {
+        write_reshapemap(reorders, n, create_default_reshape(n));
+    }
 }
 
 static void sink_reshape(shared_ptr<op::v0::Reshape> reshape,
@@ -329,6 +540,14 @@ static void sink_reshape(shared_ptr<op::v0::Reshape> reshape,
         mark_reshape_for_deletion(orig_reshape, reshapes_to_delete);
         write_reshapemap(reorders, reshape, create_default_reshape(reshape));
     }
+    else if (orig_reshape->get_input_order() ==
+                 get_default_order(orig_reshape->get_output_shape(0)) &&
+             sinking_cost(reshape, reshape->get_input_order(), reorders, 0) >
+                 shape_size(reshape->get_output_shape(0)))
+    {
+        NGRAPH_DEBUG << "Keeping " << describe_reshape(reshape) << ", sinking isn't profitable";
+        materialize_shapes(reshape, reorders, reshapes_to_delete);
+    }
     else
     {
         // combine both reshapes
@@ -513,6 +732,22 @@ static void sink_concat(shared_ptr<op::v0::Concat> n,
     write_reshapemap(reorders, new_concat, new_reshape);
 }
 
+static void sink_reduction(shared_ptr<op::util::ArithmeticReduction> reduction,
+                           ReshapeMap& reorders,
+                           set<shared_ptr<Node>>& /* reshapes_to_delete */)
+{
+    auto arg_reshape = reorders.at(reduction->get_argument(0));
+    AxisVector reduced_order;
+    AxisSet axes_in_def_order = get_reduction_axes_in_default_order(
+        arg_reshape->get_input_order(), reduction->get_reduction_axes(), reduced_order);
+    // the reduction is updated in place, its output shape is fixed up at the end
+    auto new_reshape = make_reshape(reduction, reduced_order, reduction->get_output_shape(0));
+    reduction->set_reduction_axes(axes_in_def_order);
+    NGRAPH_DEBUG << "Propagating " << describe_reshape(new_reshape) << " for "
+                 << reduction->get_name();
+    write_reshapemap(reorders, reduction, new_reshape);
+}
+
 static void sink_dequantize(shared_ptr<op::v0::Dequantize> dequantize,
                             ReshapeMap& reorders,
                             set<shared_ptr<Node>>& /* reshapes_to_delete */)
@@ -544,6 +779,7 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
     ReshapeMap reorders;
     NodeVector results;
     set<shared_ptr<Node>> reshapes_to_delete;
+    size_t transposes_before = count_transposes(f);
 
     // STEP 1 : Sink or Swim reshapes away for op clusters
     for (auto n : f->get_ordered_ops())
@@ -555,18 +791,38 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
             results.push_back(n);
         }
 
-        if (auto reshape = as_type_ptr<op::v0::Reshape>(n))
+        bool args_tracked = true;
+        for (auto arg : n->get_arguments())
+        {
+            args_tracked = args_tracked && reorders.count(arg) != 0;
+        }
+
+        if (!args_tracked)
+        {
+            materialize_shapes(n, reorders, reshapes_to_delete);
+        }
+        else if (auto reshape = as_type_ptr<op::v0::Reshape>(n))
         {
             sink_reshape(reshape, reorders, reshapes_to_delete);
         }
+        else if (!is_sinking_profitable(n, reorders))
+        {
+            materialize_shapes(n, reorders, reshapes_to_delete);
+        }
         else if (n->is_unary_elementwise_arithmetic())
         {
             sink_unary(n, reorders, reshapes_to_delete);
         }
-        else if (n->is_binary_elementwise_arithmetic())
+        else if (is_sinkable_binary(n))
         {
             sink_binary(n, reorders, reshapes_to_delete);
         }
+        else if (is_sinkable_reduction(n))
+        {
+            sink_reduction(static_pointer_cast<op::util::ArithmeticReduction>(n),
+                           reorders,
+                           reshapes_to_delete);
+        }
         else if (auto quantize = as_type_ptr<op::v0::Quantize>(n))
         {
             sink_quantize(quantize, reorders, reshapes_to_delete);
@@ -634,5 +890,7 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
     {
         n->revalidate_and_infer_types();
     }
+    NGRAPH_DEBUG << "ReshapeSinking: " << transposes_before << " transposes before, "
+                 << count_transposes(f) << " after";
     return true;
 }
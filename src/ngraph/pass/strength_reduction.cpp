@@ -0,0 +1,342 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/power.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/sum.hpp"
+#include "strength_reduction.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Reducer = function<bool(shared_ptr<Node>, pass::StrengthReductionMask)>;
+
+static bool is_reducible_type(const element::Type& type)
+{
+    return type == element::f32 || type == element::f64;
+}
+
+// Looks through broadcasts and reshapes for a constant with all elements equal
+static bool get_uniform_value(const Output<Node>& output, double& value)
+{
+    auto node = output.get_node_shared_ptr();
+    while (is_type<op::v0::Broadcast>(node) || is_type<op::v0::Reshape>(node))
+    {
+        node = node->get_input_node_shared_ptr(0);
+    }
+    auto constant = as_type_ptr<op::v0::Constant>(node);
+    if (!constant || shape_size(constant->get_output_shape(0)) == 0 ||
+        !constant->get_all_data_elements_bitwise_identical())
+    {
+        return false;
+    }
+    auto type = constant->get_output_element_type(0);
+    if (type == element::f32)
+    {
+        value = *constant->get_data_ptr<float>();
+    }
+    else if (type == element::f64)
+    {
+        value = *constant->get_data_ptr<double>();
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+static shared_ptr<Node> make_uniform(double value, const element::Type& type, const Shape& shape)
+{
+    shared_ptr<Node> constant = op::v0::Constant::create(type, Shape{}, {value});
+    if (shape.size() > 0)
+    {
+        AxisSet axes;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            axes.insert(i);
+        }
+        constant = make_shared<op::v0::Broadcast>(constant, shape, axes);
+    }
+    return constant;
+}
+
+//`reduce_power` rewrites x ^ c for small constant exponents
+//
+// exact:       x ^ 1 -> x, x ^ 2 -> x * x
+// approximate: x ^ 3 -> x * x * x, x ^ 4 -> (x * x) * (x * x), x ^ 0.5 -> sqrt(x),
+//              x ^ -1 -> 1 / x, x ^ -0.5 -> 1 / sqrt(x)
+static bool reduce_power(shared_ptr<Node> n, pass::StrengthReductionMask numerics)
+{
+    using pass::StrengthReductionType;
+
+    double exponent;
+    if (!get_uniform_value(n->input_value(1), exponent))
+    {
+        return false;
+    }
+
+    auto x = n->input_value(0);
+    auto type = n->get_output_element_type(0);
+    auto shape = n->get_output_shape(0);
+    shared_ptr<Node> replacement;
+    if (numerics.is_set(StrengthReductionType::EXACT))
+    {
+        if (exponent == 1)
+        {
+            return replace_output_update_name(n->output(0), x);
+        }
+        if (exponent == 2)
+        {
+            replacement = make_shared<op::v1::Multiply>(x, x);
+        }
+    }
+    if (!replacement && numerics.is_set(StrengthReductionType::APPROXIMATE))
+    {
+        if (exponent == 3)
+        {
+            auto square = make_shared<op::v1::Multiply>(x, x);
+            replacement = make_shared<op::v1::Multiply>(square, x);
+        }
+        else if (exponent == 4)
+        {
+            auto square = make_shared<op::v1::Multiply>(x, x);
+            replacement = make_shared<op::v1::Multiply>(square, square);
+        }
+        else if (exponent == 0.5)
+        {
+            replacement = make_shared<op::v0::Sqrt>(x);
+        }
+        else if (exponent == -1)
+        {
+            replacement = make_shared<op::v1::Divide>(make_uniform(1, type, shape), x);
+        }
+        else if (exponent == -0.5)
+        {
+            replacement = make_shared<op::v1::Divide>(make_uniform(1, type, shape),
+                                                      make_shared<op::v0::Sqrt>(x));
+        }
+    }
+
+    if (!replacement)
+    {
+        return false;
+    }
+    NGRAPH_DEBUG << "Replacing " << n->get_name() << " with " << replacement->get_name();
+    replace_node(n, replacement);
+    return true;
+}
+
+//`reduce_divide` rewrites x / c into x * (1 / c). This is exact when c is a power of two whose
+// reciprocal is a normal number of the element type.
+static bool reduce_divide(shared_ptr<Node> n, pass::StrengthReductionMask numerics)
+{
+    using pass::StrengthReductionType;
+
+    double divisor;
+    if (!get_uniform_value(n->input_value(1), divisor) || divisor == 0 || !std::isfinite(divisor))
+    {
+        return false;
+    }
+
+    auto type = n->get_output_element_type(0);
+    double reciprocal = 1 / divisor;
+    int exponent;
+    bool exact = std::fabs(std::frexp(divisor, &exponent)) == 0.5 &&
+                 (type == element::f32 ? std::isnormal(static_cast<float>(reciprocal))
+                                       : std::isnormal(reciprocal));
+    if (!numerics.is_set(exact ? StrengthReductionType::EXACT
+                               : StrengthReductionType::APPROXIMATE))
+    {
+        return false;
+    }
+
+    auto replacement = make_shared<op::v1::Multiply>(
+        n->input_value(0), make_uniform(reciprocal, type, n->get_output_shape(0)));
+    replace_node(n, replacement);
+    return true;
+}
+
+//`reassociate` rewrites (x op c1) op c2 into x op (c1 op c2), with either operand order, so
+// that a chain of constant operands collapses into a single constant
+template <typename T>
+static bool reassociate(shared_ptr<Node> n, pass::StrengthReductionMask numerics)
+{
+    if (!numerics.is_set(pass::StrengthReductionType::APPROXIMATE))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        double outer_value;
+        auto inner = n->input_value(1 - i);
+        if (!get_uniform_value(n->input_value(i), outer_value) || !is_type<T>(inner.get_node()) ||
+            inner.get_target_inputs().size() != 1)
+        {
+            continue;
+        }
+        for (size_t j = 0; j < 2; j++)
+        {
+            double inner_value;
+            if (!get_uniform_value(inner.get_node()->input_value(j), inner_value))
+            {
+                continue;
+            }
+            double value = is_type<op::v1::Multiply>(n) ? inner_value * outer_value
+                                                         : inner_value + outer_value;
+            auto replacement = make_shared<T>(
+                inner.get_node()->input_value(1 - j),
+                make_uniform(value, n->get_output_element_type(0), n->get_output_shape(0)));
+            replace_node(n, replacement);
+            return true;
+        }
+    }
+    return false;
+}
+
+//`reduce_sum_of_product` rewrites a sum of an elementwise product into a dot when the sum
+// contracts whole axes
+//
+// sum(a * b, all axes)                                  -> dot(a, b)
+// sum(x * broadcast(v, leading axes), trailing axes)    -> dot(x, v)
+// sum(x * broadcast(v, trailing axes), leading axes)    -> dot(v, x)
+static bool reduce_sum_of_product(shared_ptr<Node> n, pass::StrengthReductionMask numerics)
+{
+    if (!numerics.is_set(pass::StrengthReductionType::APPROXIMATE))
+    {
+        return false;
+    }
+
+    auto sum = static_pointer_cast<op::v0::Sum>(n);
+    auto multiply = n->input_value(0);
+    if (!is_type<op::v1::Multiply>(multiply.get_node()) ||
+        multiply.get_target_inputs().size() != 1)
+    {
+        return false;
+    }
+
+    const size_t rank = multiply.get_shape().size();
+    const AxisSet& axes = sum->get_reduction_axes();
+    const size_t count = axes.size();
+    if (rank == 0 || count == 0)
+    {
+        return false;
+    }
+
+    auto args = multiply.get_node()->input_values();
+    shared_ptr<Node> dot;
+    if (count == rank)
+    {
+        dot = make_shared<op::v0::Dot>(args[0], args[1], rank);
+    }
+    else
+    {
+        // AxisSet is ordered, so these also imply that the reduction axes are contiguous
+        bool trailing = *axes.begin() == rank - count;
+        bool leading = *axes.rbegin() == count - 1;
+        for (size_t i = 0; i < 2 && !dot && (trailing || leading); i++)
+        {
+            auto broadcast = as_type_ptr<op::v0::Broadcast>(args[i].get_node_shared_ptr());
+            if (!broadcast)
+            {
+                continue;
+            }
+            // v must span exactly the reduced axes
+            const AxisSet& broadcast_axes = broadcast->get_broadcast_axes();
+            bool complement = broadcast_axes.size() + count == rank;
+            for (auto axis : broadcast_axes)
+            {
+                complement = complement && axes.count(axis) == 0;
+            }
+            if (!complement)
+            {
+                continue;
+            }
+            auto v = broadcast->input_value(0);
+            auto x = args[1 - i];
+            dot = trailing ? make_shared<op::v0::Dot>(x, v, count)
+                           : make_shared<op::v0::Dot>(v, x, count);
+        }
+    }
+
+    if (!dot)
+    {
+        return false;
+    }
+    NGRAPH_DEBUG << "Replacing " << n->get_name() << " with " << dot->get_name();
+    replace_node(n, dot);
+    return true;
+}
+
+//`cancel_inverse` rewrites outer(inner(x)) into x for inverse functions, e.g. exp(log(x))
+template <typename Inner>
+static bool cancel_inverse(shared_ptr<Node> n, pass::StrengthReductionMask numerics)
+{
+    if (!numerics.is_set(pass::StrengthReductionType::UNSAFE_DOMAIN) ||
+        !is_type<Inner>(n->get_input_node_ptr(0)))
+    {
+        return false;
+    }
+    return replace_output_update_name(n->output(0),
+                                      n->get_input_node_ptr(0)->input_value(0));
+}
+
+bool pass::StrengthReduction::run_on_function(shared_ptr<Function> f)
+{
+    static const unordered_map<NodeTypeInfo, Reducer> reducers{
+        {op::v1::Power::type_info, reduce_power},
+        {op::v1::Divide::type_info, reduce_divide},
+        {op::v1::Multiply::type_info, Reducer{reassociate<op::v1::Multiply>}},
+        {op::v1::Add::type_info, Reducer{reassociate<op::v1::Add>}},
+        {op::v0::Sum::type_info, reduce_sum_of_product},
+        {op::v0::Exp::type_info, Reducer{cancel_inverse<op::v0::Log>}},
+        {op::v0::Log::type_info, Reducer{cancel_inverse<op::v0::Exp>}}};
+
+    bool replaced = false;
+    for (auto n : f->get_ordered_ops())
+    {
+        if (n->is_output() || n->is_parameter() || n->get_output_size() != 1 ||
+            n->get_output_partial_shape(0).is_dynamic() ||
+            !is_reducible_type(n->get_output_element_type(0)))
+        {
+            continue;
+        }
+
+        auto it = reducers.find(n->get_type_info());
+        if (it != reducers.end())
+        {
+            replaced = it->second(n, m_numerics) || replaced;
+        }
+    }
+    return replaced;
+}
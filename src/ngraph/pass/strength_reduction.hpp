@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class StrengthReduction;
+        enum class StrengthReductionType : uint32_t
+        {
+            // Rewrites that produce bitwise identical results
+            EXACT = 0x1,
+            //`APPROXIMATE` rewrites may round differently, e.g. by reassociating constants,
+            // multiplying by a reciprocal or summing in a different order
+            APPROXIMATE = 0x2,
+            //`UNSAFE_DOMAIN` rewrites drop the NaNs and infinities that the original
+            // expression produces outside of its domain, e.g. exp(log(x)) -> x
+            UNSAFE_DOMAIN = 0x4,
+            ALL = 0xFFFFFFFF
+        };
+        typedef EnumMask<StrengthReductionType> StrengthReductionMask;
+    }
+}
+
+/// \brief Replaces expensive arithmetic with cheaper equivalents.
+///
+/// Works on graphs with explicit broadcasts, as seen by backends after
+/// ImplicitBroadcastElimination. The rewrites are:
+///
+///   power(x, c)            -> x * x, x * x * x, sqrt(x), 1 / x, ... for small constant c
+///   x / c                  -> x * (1 / c)
+///   (x * c1) * c2          -> x * (c1 * c2), and likewise for add
+///   sum(x * broadcast(v))  -> dot(x, v) when the reduced axes are the broadcast ones
+///   exp(log(x)), log(exp(x)) -> x
+///
+/// Constants must be uniform, possibly broadcast or reshaped. Only f32 and f64 are rewritten.
+/// Each rewrite belongs to a StrengthReductionType and is applied only when that type is
+/// enabled.
+class NGRAPH_API ngraph::pass::StrengthReduction : public FunctionPass
+{
+public:
+    StrengthReduction(StrengthReductionMask numerics = StrengthReductionType::EXACT)
+        : FunctionPass()
+        , m_numerics(numerics)
+    {
+        set_property(PassProperty::REQUIRE_STATIC_SHAPE, true);
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    StrengthReductionMask m_numerics;
+};
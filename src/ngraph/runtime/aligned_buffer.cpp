@@ -37,7 +37,12 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment, Alloca
     , m_byte_size(byte_size)
 {
     m_byte_size = std::max<size_t>(1, byte_size);
-    size_t allocation_size = m_byte_size + alignment;
+    // Leave room to align the pointer unless the allocator already does it
+    size_t allocation_size = m_byte_size;
+    if (!allocator || !allocator->is_aligned(m_byte_size, alignment))
+    {
+        allocation_size += alignment;
+    }
     if (allocator)
     {
         m_allocated_buffer = static_cast<char*>(m_allocator->malloc(allocation_size, alignment));
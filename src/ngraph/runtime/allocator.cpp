@@ -18,6 +18,11 @@
 
 ngraph::runtime::Allocator::~Allocator() {}
 
+bool ngraph::runtime::Allocator::is_aligned(size_t /* size */, size_t /* alignment */) const
+{
+    return false;
+}
+
 class ngraph::runtime::DefaultAllocator : public ngraph::runtime::Allocator
 {
 public:
@@ -49,4 +49,9 @@ public:
     /// \brief deallocates the memory pointed by ptr
     /// \param ptr pointer to the aligned memory to be released
     virtual void free(void* ptr) = 0;
+
+    /// \brief Tells whether malloc(size, alignment) always returns memory aligned to
+    ///        `alignment`. Callers such as AlignedBuffer then request exactly `size` bytes
+    ///        instead of adding slack to align the pointer themselves.
+    virtual bool is_aligned(size_t size, size_t alignment) const;
 };
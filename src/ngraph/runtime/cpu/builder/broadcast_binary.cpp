@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast_binary.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BroadcastBinary)
+            {
+                using Kind = ngraph::op::BroadcastBinary::Kind;
+                using Layout = runtime::cpu::kernel::broadcast_binary::Layout;
+
+                auto& functors = external_function->get_functors();
+                auto binary = static_cast<const ngraph::op::BroadcastBinary*>(node);
+                const auto& et = out[0].get_element_type();
+
+                std::function<void(void*, void*, void*, const Layout&, int)> kernel;
+                switch (binary->get_kind())
+                {
+                case Kind::Add:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_add);
+                    break;
+                case Kind::Subtract:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_subtract);
+                    break;
+                case Kind::Multiply:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_multiply);
+                    break;
+                case Kind::Divide:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_divide);
+                    break;
+                case Kind::Maximum:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_maximum);
+                    break;
+                case Kind::Minimum:
+                    SELECT_KERNEL(kernel, et, runtime::cpu::kernel::broadcast_minimum);
+                    break;
+                }
+
+                auto layout = runtime::cpu::kernel::broadcast_binary::make_layout(
+                    out[0].get_shape(),
+                    binary->get_broadcast_axes0(),
+                    binary->get_broadcast_axes1());
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                kernel,
+                                layout,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out0_buffer_index],
+                           layout,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_broadcast_binary_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::BroadcastBinary);
+            }
+        }
+    }
+}
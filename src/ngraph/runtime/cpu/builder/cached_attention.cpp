@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/cached_attention.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/cached_attention.hpp"
+#include "ngraph/state/kv_cache_state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CachedAttention)
+            {
+                auto& functors = external_function->get_functors();
+                auto attention = static_cast<const ngraph::op::CachedAttention*>(node);
+
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type for CachedAttention");
+                }
+
+                auto query_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto key_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto value_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                // Without a positions input every call uses all positions
+                bool has_positions = attention->has_positions();
+                bool positions_i64 = has_positions && args[3].get_element_type() == element::i64;
+                auto positions_buffer_index =
+                    has_positions ? external_function->get_buffer_index(args[3].get_name()) : 0;
+
+                const auto& key_shape = args[1].get_shape();
+                size_t sequences = key_shape[0];
+                size_t capacity = key_shape[1];
+                size_t key_dim = key_shape[2];
+                size_t value_dim = args[2].get_shape()[2];
+                float scale = attention->get_scale();
+
+                auto index = external_function->add_state(
+                    new ngraph::KVCacheState(sequences,
+                                             attention->get_max_length(),
+                                             key_dim * sizeof(float),
+                                             value_dim * sizeof(float)));
+
+                auto functor = [&,
+                                index,
+                                query_buffer_index,
+                                key_buffer_index,
+                                value_buffer_index,
+                                out_buffer_index,
+                                has_positions,
+                                positions_i64,
+                                positions_buffer_index,
+                                sequences,
+                                capacity,
+                                key_dim,
+                                value_dim,
+                                scale](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    size_t positions = capacity;
+                    if (has_positions)
+                    {
+                        void* data = ctx->buffer_data[positions_buffer_index];
+                        int64_t requested = positions_i64 ? *static_cast<int64_t*>(data)
+                                                          : *static_cast<int32_t*>(data);
+                        if (requested < 0 || static_cast<size_t>(requested) > capacity)
+                        {
+                            throw ngraph_error("CachedAttention positions " +
+                                               to_string(requested) + " out of range [0, " +
+                                               to_string(capacity) + "]");
+                        }
+                        positions = static_cast<size_t>(requested);
+                    }
+                    runtime::cpu::kernel::cached_attention<float>(
+                        static_cast<float*>(ctx->buffer_data[query_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[key_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[value_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        static_cast<KVCacheState*>(ctx->states[index]),
+                        sequences,
+                        positions,
+                        capacity,
+                        key_dim,
+                        value_dim,
+                        scale,
+                        ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_cached_attention_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::CachedAttention);
+            }
+        }
+    }
+}
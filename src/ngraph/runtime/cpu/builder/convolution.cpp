@@ -21,6 +21,7 @@
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 
@@ -753,6 +754,169 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBiasBackprop)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBiasBackprop*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
+                auto out2_buffer_index = external_function->get_buffer_index(out[2].get_name());
+
+                if (!runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
+                {
+                    throw ngraph_error(
+                        "ConvolutionBiasBackprop is only supported with DNNL kernel.");
+                }
+
+                auto& dnnl_emitter = external_function->get_dnnl_emitter();
+                auto data_desc = dnnl_emitter->get_convolution_bias_backprop_data_desc(node);
+                auto data_fwd_desc =
+                    dnnl_emitter->get_convolution_bias_backprop_data_fwd_desc(node);
+                auto weights_desc = dnnl_emitter->get_convolution_bias_backprop_weights_desc(node);
+                auto weights_fwd_desc =
+                    dnnl_emitter->get_convolution_bias_backprop_weights_fwd_desc(node);
+                size_t data_scratchpad_size =
+                    QUERY_SCRATCHPAD_2ARGS(convolution_backward_data, data_fwd_desc, data_desc);
+                size_t weights_scratchpad_size = QUERY_SCRATCHPAD_2ARGS(
+                    convolution_backward_weights, weights_fwd_desc, weights_desc);
+
+                // The masked delta needs 4 primitives: relu input, delta, masked delta, and
+                // eltwise_backward, plus a workspace to hold the masked delta.
+                bool with_relu = convolution->with_relu();
+                size_t relu_index = 0;
+                size_t relu_scratchpad_size = 0;
+                size_t arg3_buffer_index = 0;
+                std::shared_ptr<dnnl::eltwise_backward::desc> relu_desc;
+                std::shared_ptr<dnnl::eltwise_forward::desc> relu_fwd_desc;
+                std::vector<size_t>* relu_deps = nullptr;
+                if (with_relu)
+                {
+                    arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                    relu_desc = std::make_shared<dnnl::eltwise_backward::desc>(
+                        dnnl_emitter->get_convolution_bias_backprop_relu_desc(node));
+                    relu_fwd_desc = std::make_shared<dnnl::eltwise_forward::desc>(
+                        dnnl_emitter->get_convolution_bias_backprop_relu_fwd_desc(node));
+                    relu_scratchpad_size =
+                        QUERY_SCRATCHPAD_2ARGS(eltwise_backward, *relu_fwd_desc, *relu_desc);
+                    relu_index = dnnl_emitter->reserve_primitive_space(4, false, true);
+                    relu_deps = &dnnl_emitter->get_primitive_deps(relu_index);
+                }
+
+                // The data gradient needs 4 primitives: weights, diff_dst, diff_src, and
+                // convolution_backward_data. The filters and bias gradients need 5 primitives:
+                // src, diff_dst, diff_weights, diff_bias, and convolution_backward_weights.
+                // Both read the same diff_dst layout, chosen by CPULayout.
+                auto data_index = dnnl_emitter->reserve_primitive_space(4);
+                auto& data_deps = dnnl_emitter->get_primitive_deps(data_index);
+                auto weights_index = dnnl_emitter->reserve_primitive_space(5);
+                auto& weights_deps = dnnl_emitter->get_primitive_deps(weights_index);
+
+                auto functor = [&,
+                                with_relu,
+                                relu_desc,
+                                relu_fwd_desc,
+                                relu_deps,
+                                data_desc,
+                                data_fwd_desc,
+                                weights_desc,
+                                weights_fwd_desc,
+                                relu_index,
+                                data_index,
+                                weights_index,
+                                relu_scratchpad_size,
+                                data_scratchpad_size,
+                                weights_scratchpad_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                arg3_buffer_index,
+                                out0_buffer_index,
+                                out1_buffer_index,
+                                out2_buffer_index](CPURuntimeContext* ctx,
+                                                   CPUExecutionContext* /* ectx */) {
+                    if (ctx->first_iteration)
+                    {
+                        if (with_relu)
+                        {
+                            dnnl_emitter->build_convolution_bias_backprop_relu(
+                                ctx->dnnl_memories,
+                                ctx->dnnl_primitives,
+                                ctx->dnnl_scratchpad_mds,
+                                ctx->dnnl_workspaces,
+                                *relu_desc,
+                                *relu_fwd_desc,
+                                *relu_deps,
+                                relu_index);
+                        }
+                        dnnl_emitter->build_convolution_backward_data(ctx->dnnl_memories,
+                                                                      ctx->dnnl_primitives,
+                                                                      ctx->dnnl_scratchpad_mds,
+                                                                      data_desc,
+                                                                      data_fwd_desc,
+                                                                      data_deps,
+                                                                      data_index);
+                        dnnl_emitter->build_convolution_backward_weights_bias(
+                            ctx->dnnl_memories,
+                            ctx->dnnl_primitives,
+                            ctx->dnnl_scratchpad_mds,
+                            weights_desc,
+                            weights_fwd_desc,
+                            weights_deps,
+                            weights_index);
+                    }
+
+                    void* delta = ctx->buffer_data[arg2_buffer_index];
+                    if (with_relu)
+                    {
+                        auto& deps = *relu_deps;
+                        cpu::dnnl_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg3_buffer_index]);
+                        cpu::dnnl_utils::set_memory_ptr(ctx, deps[1], delta);
+                        delta = ctx->dnnl_workspaces[deps[3]];
+                        cpu::dnnl_utils::set_memory_ptr(ctx, deps[2], delta);
+
+                        cpu::dnnl_utils::dnnl_invoke_primitive(
+                            ctx,
+                            relu_index,
+                            deps,
+                            cpu::dnnl_utils::OpType::RELUBACKPROP,
+                            relu_scratchpad_size);
+                    }
+
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, data_deps[0], ctx->buffer_data[arg1_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(ctx, data_deps[1], delta);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, data_deps[2], ctx->buffer_data[out0_buffer_index]);
+                    cpu::dnnl_utils::dnnl_invoke_primitive(
+                        ctx,
+                        data_index,
+                        data_deps,
+                        cpu::dnnl_utils::OpType::CONVOLUTIONBACKPROPDATA,
+                        data_scratchpad_size);
+
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, weights_deps[0], ctx->buffer_data[arg0_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(ctx, weights_deps[1], delta);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, weights_deps[2], ctx->buffer_data[out1_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, weights_deps[3], ctx->buffer_data[out2_buffer_index]);
+                    cpu::dnnl_utils::dnnl_invoke_primitive(
+                        ctx,
+                        weights_index,
+                        weights_deps,
+                        cpu::dnnl_utils::OpType::CONVOLUTIONBACKPROPWEIGHTSBIAS,
+                        weights_scratchpad_size);
+                };
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::GroupConvolution)
             {
@@ -977,6 +1141,7 @@ namespace ngraph
                 REGISTER_OP_BUILDER(ngraph::op::v0::ConvolutionBackpropData);
                 REGISTER_OP_BUILDER(ngraph::op::v0::ConvolutionBackpropFilters);
                 REGISTER_OP_BUILDER(ngraph::op::v0::ConvolutionBiasBackpropFiltersBias);
+                REGISTER_OP_BUILDER(ngraph::op::ConvolutionBiasBackprop);
                 REGISTER_OP_BUILDER(ngraph::op::v0::GroupConvolution);
                 REGISTER_OP_BUILDER(ngraph::op::ConvolutionAdd);
                 REGISTER_OP_BUILDER(ngraph::op::GroupConvolutionBias);
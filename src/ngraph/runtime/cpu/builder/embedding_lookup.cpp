@@ -19,6 +19,7 @@
 
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 
 using namespace std;
@@ -51,7 +52,44 @@ namespace ngraph
                 auto out_shape = out[0].get_shape();
                 auto element_type = out[0].get_element_type();
                 auto index_element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+                if (!runtime::cpu::use_ref_kernels())
+                {
+                    decltype(&runtime::cpu::kernel::embedding_lookup<float>) kernel;
+                    if (index_element_type == element::f32)
+                    {
+                        kernel = runtime::cpu::kernel::embedding_lookup<float>;
+                    }
+                    else if (index_element_type == element::i32)
+                    {
+                        kernel = runtime::cpu::kernel::embedding_lookup<int>;
+                    }
+                    else if (index_element_type == element::i64)
+                    {
+                        kernel = runtime::cpu::kernel::embedding_lookup<int64_t>;
+                    }
+                    else
+                    {
+                        throw ngraph_error(
+                            "Unsupported index type in CPU Builder for EmbeddingLookup");
+                    }
+                    auto row_bytes = in_shape.at(1) * element_type.size();
+                    functor = [&,
+                               kernel,
+                               element_count,
+                               row_bytes,
+                               arg0_buffer_index,
+                               arg1_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[arg1_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               element_count,
+                               row_bytes,
+                               ectx->arena);
+                    };
+                }
+                else if (element_type == element::f32)
                 {
                     if (index_element_type == element::f32)
                     {
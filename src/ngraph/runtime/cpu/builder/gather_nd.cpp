@@ -18,6 +18,7 @@
 
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/gather_nd.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
 
 using namespace std;
@@ -49,7 +50,30 @@ namespace ngraph
                 auto indices_shape = args[1].get_shape();
                 auto out_shape = out[0].get_shape();
                 auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+                if (!runtime::cpu::use_ref_kernels())
+                {
+                    auto kernel = is_int64 ? runtime::cpu::kernel::gather_nd<int64_t>
+                                           : runtime::cpu::kernel::gather_nd<int32_t>;
+                    auto element_size = element_type.size();
+                    functor = [&,
+                               kernel,
+                               params_shape,
+                               indices_shape,
+                               element_size,
+                               params_buffer_index,
+                               indices_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[params_buffer_index],
+                               ctx->buffer_data[indices_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               params_shape,
+                               indices_shape,
+                               element_size,
+                               ectx->arena);
+                    };
+                }
+                else if (element_type == element::f32)
                 {
                     if (is_int64)
                     {
@@ -18,6 +18,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/lrn.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 
 using namespace std;
@@ -87,7 +88,35 @@ namespace ngraph
                     Shape axes_shape = args[1].get_shape();
 
                     auto element_type = lrn->get_output_element_type(0);
-                    if (element_type == element::f32)
+                    if (!runtime::cpu::use_ref_kernels() &&
+                        (element_type == element::f32 || element_type == element::f64))
+                    {
+                        auto kernel = element_type == element::f32
+                                          ? runtime::cpu::kernel::lrn<float>
+                                          : runtime::cpu::kernel::lrn<double>;
+                        functor = [&,
+                                   kernel,
+                                   alpha,
+                                   beta,
+                                   bias,
+                                   arg_shape,
+                                   axes,
+                                   nsize,
+                                   arg_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   arg_shape,
+                                   axes,
+                                   alpha,
+                                   beta,
+                                   bias,
+                                   nsize,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (element_type == element::f32)
                     {
                         functor = [&,
                                    alpha,
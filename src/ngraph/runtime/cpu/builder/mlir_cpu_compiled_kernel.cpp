@@ -87,9 +87,29 @@ namespace ngraph
                     strides_vec.push_back(strides);
                 }
 
-                // Create functor that will be executed to compile and run this CompiledKernel.
-                // Note that 'double_ptr_args' must be captured by value since it's a local var.
-                auto functor = [node, buffer_indices, shape_vec, strides_vec](
+                // Compile the sub-graph once, while the function is being compiled, instead of
+                // lazily on the first call of every runtime context. The runtime owns the MLIR
+                // context and the JITed code and is shared by all contexts.
+                CompiledKernel* compiled_kernel =
+                    static_cast<CompiledKernel*>(const_cast<Node*>(node));
+                auto mlir_runtime = std::make_shared<MLIRCPURuntime>();
+                {
+                    // Grab the context and initialize a core compiler
+                    mlir::MLIRContext& context = mlir_runtime->get_context();
+                    MLIRCompiler mlir_compiler(compiled_kernel->get_function(), context);
+                    // Compile to NG dialect
+                    mlir_compiler.compile();
+                    // Grab a context and initialize a CPU backend using same context
+                    MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
+                    // Codegen to LLVM dialect
+                    mlir_backend.codegen();
+                    // Store module into runtime and JIT it
+                    mlir_runtime->set_module(mlir_backend.get_module());
+                    mlir_runtime->compile();
+                }
+
+                // Create functor that will be executed to run this CompiledKernel.
+                auto functor = [mlir_runtime, buffer_indices, shape_vec, strides_vec](
                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     // MLIR requires a list of type-erased pointer to arguments. Tensors must have
                     // been allocated at this point so we can get rid of the extra reference.
@@ -105,44 +125,7 @@ namespace ngraph
                         i++;
                     }
 
-                    // Compile nodes within the CompiledKernel op.
-                    CompiledKernel* compiled_kernel =
-                        static_cast<CompiledKernel*>(const_cast<Node*>(node));
-
-                    auto it = ctx->mlir_runtimes.find(compiled_kernel);
-
-                    if (it == ctx->mlir_runtimes.end())
-                    {
-                        // Compile the sub-graph and create a new runtime
-                        // We must create an MLIRContext that out lives the compilation/execution
-                        // The runtime contains the context and gets store in the CK cache
-
-                        // Runtime contains context and must be constructed in-place.
-                        // MLIR contexts cannot be copied over
-                        ctx->mlir_runtimes.emplace(std::piecewise_construct,
-                                                   std::make_tuple(compiled_kernel),
-                                                   std::make_tuple());
-                        MLIRCPURuntime& mlir_runtime =
-                            ctx->mlir_runtimes.find(compiled_kernel)->second;
-                        // Grab the context and initialize a core compiler
-                        mlir::MLIRContext& context = mlir_runtime.get_context();
-                        MLIRCompiler mlir_compiler(compiled_kernel->get_function(), context);
-                        // Compile to NG dialect
-                        mlir_compiler.compile();
-                        // Grab a context and initialize a CPU backend using same context
-                        MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
-                        // Codegen to LLVM dialect
-                        mlir_backend.codegen();
-                        // Store module into runtime, and invoke.
-                        mlir_runtime.set_module(mlir_backend.get_module());
-                        mlir_runtime.run(mem_ref_arg_vec, true /*firstIteration*/);
-                    }
-                    else
-                    {
-                        // We have found a cached runtime, just invoke.
-                        MLIRCPURuntime& mlir_runtime = it->second;
-                        mlir_runtime.run(mem_ref_arg_vec, false /*firstIteration*/);
-                    }
+                    mlir_runtime->run_in_arena(mem_ref_arg_vec, ectx->arena);
                 };
 
                 functors.emplace_back(functor);
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::OptimizerUpdate)
+            {
+                using Algorithm = ngraph::op::OptimizerUpdate::Algorithm;
+                using Tensors = runtime::cpu::kernel::optimizer::Tensors<float>;
+
+                auto& functors = external_function->get_functors();
+                auto update = static_cast<const ngraph::op::OptimizerUpdate*>(node);
+
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type for OptimizerUpdate");
+                }
+
+                const auto algorithm = update->get_algorithm();
+                const size_t states = ngraph::op::OptimizerUpdate::get_state_count(algorithm);
+                const size_t params = update->get_parameter_count();
+
+                // Per parameter: param, grad, state0, state1, and the three matching outputs.
+                // Missing state slots are left as the param index and never read.
+                std::vector<size_t> buffer_indices;
+                std::vector<size_t> sizes;
+                for (size_t p = 0; p < params; p++)
+                {
+                    size_t in = p * (states + 2);
+                    size_t o = p * (states + 1);
+                    auto index = [&](const TensorWrapper& tw) {
+                        return external_function->get_buffer_index(tw.get_name());
+                    };
+                    buffer_indices.push_back(index(args[in]));
+                    buffer_indices.push_back(index(args[in + 1]));
+                    buffer_indices.push_back(index(args[in + 2]));
+                    buffer_indices.push_back(index(args[states > 1 ? in + 3 : in]));
+                    buffer_indices.push_back(index(out[o]));
+                    buffer_indices.push_back(index(out[o + 1]));
+                    buffer_indices.push_back(index(out[states > 1 ? o + 2 : o]));
+                    sizes.push_back(out[o].get_size());
+                }
+                auto chunks = runtime::cpu::kernel::optimizer::make_chunks(sizes);
+
+                float learning_rate = update->get_learning_rate();
+                float beta1 = update->get_beta1();
+                float beta2 = update->get_beta2();
+                float epsilon = update->get_epsilon();
+                float weight_decay = update->get_weight_decay();
+
+                auto functor = [&,
+                                algorithm,
+                                params,
+                                buffer_indices,
+                                chunks,
+                                learning_rate,
+                                beta1,
+                                beta2,
+                                epsilon,
+                                weight_decay](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    std::vector<Tensors> tensors(params);
+                    for (size_t p = 0; p < params; p++)
+                    {
+                        auto buffer = [&](size_t i) {
+                            return static_cast<float*>(
+                                ctx->buffer_data[buffer_indices[p * 7 + i]]);
+                        };
+                        tensors[p] = {buffer(0),
+                                      buffer(1),
+                                      buffer(2),
+                                      buffer(3),
+                                      buffer(4),
+                                      buffer(5),
+                                      buffer(6)};
+                    }
+
+                    switch (algorithm)
+                    {
+                    case Algorithm::SGDMomentum:
+                        runtime::cpu::kernel::sgd_momentum_update<float>(
+                            tensors, chunks, learning_rate, beta1, weight_decay, ectx->arena);
+                        break;
+                    case Algorithm::Adam:
+                        runtime::cpu::kernel::adam_update<float>(tensors,
+                                                                 chunks,
+                                                                 learning_rate,
+                                                                 beta1,
+                                                                 beta2,
+                                                                 epsilon,
+                                                                 weight_decay,
+                                                                 ectx->arena);
+                        break;
+                    case Algorithm::Lamb:
+                        runtime::cpu::kernel::lamb_update<float>(tensors,
+                                                                 chunks,
+                                                                 learning_rate,
+                                                                 beta1,
+                                                                 beta2,
+                                                                 epsilon,
+                                                                 weight_decay,
+                                                                 ectx->arena);
+                        break;
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_optimizer_update_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::OptimizerUpdate);
+            }
+        }
+    }
+}
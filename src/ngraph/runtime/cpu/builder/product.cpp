@@ -18,6 +18,7 @@
 
 #include "ngraph/op/product.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
 
 #include "reduction.hpp"
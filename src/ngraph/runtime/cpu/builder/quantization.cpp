@@ -23,6 +23,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/quantization.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
 
@@ -35,6 +36,45 @@ namespace ngraph
     {
         namespace cpu
         {
+            using DequantizeKernel = decltype(&runtime::cpu::kernel::dequantize<int8_t, float>);
+            using QuantizeKernel = decltype(&runtime::cpu::kernel::quantize<float, int8_t>);
+
+            template <typename REAL>
+            static DequantizeKernel get_dequantize_kernel(const element::Type& quant_type)
+            {
+                if (quant_type == element::i8)
+                {
+                    return runtime::cpu::kernel::dequantize<int8_t, REAL>;
+                }
+                else if (quant_type == element::u8)
+                {
+                    return runtime::cpu::kernel::dequantize<uint8_t, REAL>;
+                }
+                else if (quant_type == element::i32)
+                {
+                    return runtime::cpu::kernel::dequantize<int32_t, REAL>;
+                }
+                throw ngraph_error("Unsupported input element type");
+            }
+
+            template <typename REAL>
+            static QuantizeKernel get_quantize_kernel(const element::Type& quant_type)
+            {
+                if (quant_type == element::i8)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, int8_t>;
+                }
+                else if (quant_type == element::u8)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, uint8_t>;
+                }
+                else if (quant_type == element::i32)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, int32_t>;
+                }
+                throw ngraph_error("Unsupported quantization element type");
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Dequantize)
             {
@@ -168,7 +208,41 @@ namespace ngraph
                     auto arg1_shape = args[1].get_shape();
                     auto daxes = dequantize->get_axes();
 
-                    if (args[0].get_element_type() == element::i8)
+                    if (!runtime::cpu::use_ref_kernels())
+                    {
+                        DequantizeKernel kernel;
+                        if (out[0].get_element_type() == element::f32)
+                        {
+                            kernel = get_dequantize_kernel<float>(args[0].get_element_type());
+                        }
+                        else if (out[0].get_element_type() == element::f64)
+                        {
+                            kernel = get_dequantize_kernel<double>(args[0].get_element_type());
+                        }
+                        else
+                        {
+                            throw ngraph_error("Unsupported dequantization element type");
+                        }
+                        auto layout =
+                            runtime::cpu::kernel::quantization::make_layout(arg0_shape, daxes);
+
+                        functor = [&,
+                                   kernel,
+                                   layout,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   layout,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::i8)
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
@@ -464,7 +538,43 @@ namespace ngraph
                     auto daxes = quantize->get_axes();
                     ngraph::op::v0::Quantize::RoundMode round_mode = quantize->get_round_mode();
 
-                    if (args[0].get_element_type() == element::f32)
+                    if (!runtime::cpu::use_ref_kernels())
+                    {
+                        QuantizeKernel kernel;
+                        if (args[0].get_element_type() == element::f32)
+                        {
+                            kernel = get_quantize_kernel<float>(out[0].get_element_type());
+                        }
+                        else if (args[0].get_element_type() == element::f64)
+                        {
+                            kernel = get_quantize_kernel<double>(out[0].get_element_type());
+                        }
+                        else
+                        {
+                            throw ngraph_error("Unsupported input element type");
+                        }
+                        auto layout =
+                            runtime::cpu::kernel::quantization::make_layout(arg0_shape, daxes);
+
+                        functor = [&,
+                                   kernel,
+                                   layout,
+                                   round_mode,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   layout,
+                                   round_mode,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::f32)
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
@@ -19,6 +19,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_logical.hpp"
 #include "ngraph/runtime/reference/all.hpp"
 #include "ngraph/runtime/reference/any.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -44,6 +45,21 @@ namespace ngraph
                 auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
+                if (!runtime::cpu::use_ref_kernels())
+                {
+                    auto functor =
+                        [&, arg0_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            runtime::cpu::kernel::reduce_any(ctx->buffer_data[arg0_buffer_index],
+                                                             ctx->buffer_data[out_buffer_index],
+                                                             arg0_shape,
+                                                             reduction_axes,
+                                                             ectx->arena);
+                        };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto functor =
                     [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
@@ -69,6 +85,21 @@ namespace ngraph
                 auto out_shape = out[0].get_shape();
 
                 auto reduction_axes = reduce->get_reduction_axes();
+                if (!runtime::cpu::use_ref_kernels())
+                {
+                    auto functor =
+                        [&, arg0_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
+                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                            runtime::cpu::kernel::reduce_all(ctx->buffer_data[arg0_buffer_index],
+                                                             ctx->buffer_data[out_buffer_index],
+                                                             arg0_shape,
+                                                             reduction_axes,
+                                                             ectx->arena);
+                        };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 auto functor =
                     [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
@@ -41,6 +41,23 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
+    if (runtime::cpu::executor::is_deterministic() &&                                              \
+        (result_element_type == element::f32 || result_element_type == element::f64))              \
+    {                                                                                              \
+        std::function<decltype(runtime::cpu::kernel::deterministic_##K<float>)> kernel;            \
+        SELECT_KERNEL(kernel, result_element_type, runtime::cpu::kernel::deterministic_##K);       \
+        runtime::cpu::kernel::deterministic::ReductionPlan plan(arg_shape, reduction_axes);        \
+        auto functor = [&, kernel, plan, arg_buffer_index, out_buffer_index](                      \
+                           CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                    \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   plan,                                                                           \
+                   ectx->arena);                                                                   \
+        };                                                                                         \
+        functors.emplace_back(functor);                                                            \
+        return;                                                                                    \
+    }                                                                                              \
+                                                                                                   \
     if (reduction_axes.size() == arg_rank && is_optimized_et(args[0].get_element_type()))          \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
@@ -18,6 +18,7 @@
 
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/scatter_nd_add.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
 
 using namespace std;
@@ -51,7 +52,39 @@ namespace ngraph
                 auto updates_shape = args[2].get_shape();
                 auto out_shape = out[0].get_shape();
                 auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+                if (!runtime::cpu::use_ref_kernels())
+                {
+                    std::function<decltype(runtime::cpu::kernel::scatter_nd_add_i64<float>)>
+                        kernel;
+                    if (is_int64)
+                    {
+                        SELECT_KERNEL(
+                            kernel, element_type, runtime::cpu::kernel::scatter_nd_add_i64);
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(
+                            kernel, element_type, runtime::cpu::kernel::scatter_nd_add_i32);
+                    }
+                    functor = [&,
+                               kernel,
+                               inputs_shape,
+                               indices_shape,
+                               inputs_buffer_index,
+                               indices_buffer_index,
+                               updates_buffer_index,
+                               out_buffer_index](CPURuntimeContext* ctx,
+                                                 CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[inputs_buffer_index],
+                               ctx->buffer_data[indices_buffer_index],
+                               ctx->buffer_data[updates_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               inputs_shape,
+                               indices_shape,
+                               ectx->arena);
+                    };
+                }
+                else if (element_type == element::f32)
                 {
                     if (is_int64)
                     {
@@ -19,6 +19,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
 
@@ -45,6 +46,26 @@ namespace ngraph
 
                 auto axes = softmax->get_axes();
 
+                auto& element_type = args[0].get_element_type();
+                if (runtime::cpu::executor::is_deterministic() &&
+                    (element_type == element::f32 || element_type == element::f64))
+                {
+                    std::function<decltype(runtime::cpu::kernel::deterministic_softmax<float>)>
+                        kernel;
+                    SELECT_KERNEL(
+                        kernel, element_type, runtime::cpu::kernel::deterministic_softmax);
+                    runtime::cpu::kernel::deterministic::ReductionPlan plan(arg_shape, axes);
+                    auto functor = [&, kernel, plan, arg_buffer_index, out_buffer_index](
+                                       CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               plan,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
                 {
                     auto& dnnl_emitter = external_function->get_dnnl_emitter();
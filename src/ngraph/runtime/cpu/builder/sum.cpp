@@ -18,6 +18,7 @@
 
 #include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 
 #include "reduction.hpp"
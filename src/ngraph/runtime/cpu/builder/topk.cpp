@@ -53,6 +53,10 @@ namespace ngraph
                 auto k = topk->get_k();
                 auto compute_max = topk->get_compute_max();
                 auto sort = topk->get_sort();
+                // Outputs without consumers are not written; their buffers are the shared sink
+                // set up by CPUMemoryAssignment
+                bool indices_used = !node->output(0).get_target_inputs().empty();
+                bool values_used = !node->output(1).get_target_inputs().empty();
 
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
@@ -66,14 +70,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<float, int64_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int64_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<float*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
@@ -91,14 +101,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<float, int32_t>(
                                 static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int32_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<float*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
@@ -119,14 +135,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<double, int64_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int64_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<double*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
@@ -144,14 +166,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<double, int32_t>(
                                 static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int32_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<double*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
@@ -172,14 +200,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<int32_t, int64_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int64_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<int32_t*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
@@ -197,14 +231,20 @@ namespace ngraph
                                    k,
                                    compute_max,
                                    sort,
+                                   indices_used,
+                                   values_used,
                                    arg_buffer_index,
                                    out_indices_buffer_index,
                                    out_values_buffer_index](CPURuntimeContext* ctx,
                                                             CPUExecutionContext* /* ectx */) {
                             ngraph::runtime::reference::topk<int32_t, int32_t>(
                                 static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
+                                indices_used ? static_cast<int32_t*>(
+                                                   ctx->buffer_data[out_indices_buffer_index])
+                                             : nullptr,
+                                values_used ? static_cast<int32_t*>(
+                                                  ctx->buffer_data[out_values_buffer_index])
+                                            : nullptr,
                                 in_shape,
                                 out_shape,
                                 axis,
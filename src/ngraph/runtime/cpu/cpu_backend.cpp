@@ -23,12 +23,18 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
 #include "ngraph/util.hpp"
 
@@ -115,6 +121,15 @@ shared_ptr<runtime::Executable>
     runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func,
                                        ngraph::pass::PassConfig& pass_config,
                                        bool performance_counters_enabled)
+{
+    return compile(func, pass_config, ExecutionProfile(), performance_counters_enabled);
+}
+
+shared_ptr<runtime::Executable>
+    runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func,
+                                       ngraph::pass::PassConfig& pass_config,
+                                       const ExecutionProfile& profile,
+                                       bool performance_counters_enabled)
 {
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     if (m_execution_mode == EXECUTION_MODE::MLIR)
@@ -143,7 +158,8 @@ shared_ptr<runtime::Executable>
                                      pass_config,
                                      get_host_memory_allocator(),
                                      performance_counters_enabled,
-                                     m_execution_mode);
+                                     m_execution_mode,
+                                     profile);
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
@@ -151,9 +167,41 @@ shared_ptr<runtime::Executable>
     }
 }
 
-bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
+bool runtime::cpu::CPU_Backend::is_supported(const Node& op) const
 {
-    return true;
+    bool uses_bf16 = false;
+    for (auto& input : op.inputs())
+    {
+        uses_bf16 |= input.get_element_type() == element::bf16;
+    }
+    for (auto& output : op.outputs())
+    {
+        uses_bf16 |= output.get_element_type() == element::bf16;
+    }
+    if (!uses_bf16 || is_type<op::v0::Parameter>(&op) || is_type<op::v0::Result>(&op) ||
+        is_type<op::v0::Convert>(&op))
+    {
+        return true;
+    }
+
+    // Apart from the conversions above, bf16 is only computed by DNNL kernels
+    static const bool bf16_supported = runtime::cpu::dnnl_utils::is_bf16_supported();
+    if (!bf16_supported)
+    {
+        return false;
+    }
+    if (is_type<op::v0::Convolution>(&op))
+    {
+        return runtime::cpu::dnnl_utils::can_use_dnnl_conv<op::v0::Convolution>(
+            const_cast<Node*>(&op));
+    }
+    if (auto max_pool = as_type<const op::v0::MaxPool>(&op))
+    {
+        auto arg0_rank = op.get_input_shape(0).size();
+        auto window_rank = max_pool->get_window_shape().size();
+        return (arg0_rank == 4 && window_rank == 2) || (arg0_rank == 5 && window_rank == 3);
+    }
+    return false;
 }
 
 bool runtime::cpu::CPU_Backend::is_supported_property(const Property prop) const
@@ -27,6 +27,7 @@
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
 
 namespace ngraph
 {
@@ -68,6 +69,15 @@ namespace ngraph
                             ngraph::pass::PassConfig& pass_config,
                             bool enable_performance_counters = false) override;
 
+                /// \brief Compile func with profile, recorded by an earlier run of the same
+                ///        function, to guide choices such as which ops run on the calling
+                ///        thread. A profile recorded for other ops is ignored.
+                std::shared_ptr<ngraph::runtime::Executable>
+                    compile(std::shared_ptr<Function> func,
+                            ngraph::pass::PassConfig& pass_config,
+                            const ExecutionProfile& profile,
+                            bool enable_performance_counters = false);
+
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
                 Allocator* get_host_memory_allocator() override;
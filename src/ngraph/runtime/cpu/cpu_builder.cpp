@@ -23,6 +23,7 @@
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
+#include "ngraph/env_util.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
@@ -668,6 +669,12 @@ namespace ngraph
                 return build_cf_dispatcher_cpu;
             }
 
+            bool use_ref_kernels()
+            {
+                static bool s_use_ref_kernels = getenv_bool("NGRAPH_CPU_USE_REF_KERNELS");
+                return s_use_ref_kernels;
+            }
+
             void register_cpu_builders()
             {
                 REGISTER_OP_BUILDER(ngraph::op::v0::Constant);
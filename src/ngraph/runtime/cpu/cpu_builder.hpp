@@ -135,6 +135,11 @@ namespace ngraph
             // build the map to use cpu kernel for node execution
             CPU_BACKEND_API BuildNodeExecutorMap& GetGlobalCFDispatcherCPU();
 
+            // True when NGRAPH_CPU_USE_REF_KERNELS is set. Builders that have their own threaded
+            // kernels fall back to the single-threaded reference ones, which are kept for
+            // debugging.
+            bool use_ref_kernels();
+
             class Builder
             {
             public:
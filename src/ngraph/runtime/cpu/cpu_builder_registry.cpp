@@ -31,7 +31,9 @@ namespace ngraph
                 register_builders_batch_norm_cpp();
                 register_builders_bounded_relu_cpp();
                 register_builders_broadcast_cpp();
+                register_builders_broadcast_binary_cpp();
                 register_builders_broadcast_distributed_cpp();
+                register_builders_cached_attention_cpp();
                 register_builders_concat_cpp();
                 register_builders_convert_cpp();
                 register_builders_convert_layout_cpp();
@@ -52,6 +54,7 @@ namespace ngraph
                 register_builders_max_pool_cpp();
                 register_builders_min_cpp();
                 register_builders_one_hot_cpp();
+                register_builders_optimizer_update_cpp();
                 register_builders_pad_cpp();
                 register_builders_product_cpp();
                 register_builders_quantization_cpp();
@@ -30,7 +30,9 @@ namespace ngraph
             void register_builders_batch_norm_cpp();
             void register_builders_bounded_relu_cpp();
             void register_builders_broadcast_cpp();
+            void register_builders_broadcast_binary_cpp();
             void register_builders_broadcast_distributed_cpp();
+            void register_builders_cached_attention_cpp();
             void register_builders_concat_cpp();
             void register_builders_convert_cpp();
             void register_builders_convert_layout_cpp();
@@ -51,6 +53,7 @@ namespace ngraph
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
             void register_builders_one_hot_cpp();
+            void register_builders_optimizer_update_cpp();
             void register_builders_pad_cpp();
             void register_builders_product_cpp();
             void register_builders_quantization_cpp();
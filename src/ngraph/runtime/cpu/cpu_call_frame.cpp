@@ -21,6 +21,7 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
@@ -37,6 +38,7 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_init_ctx_func(compiled_init_ctx_func)
     , m_compiled_destroy_ctx_func(compiled_destroy_ctx_func)
     , m_compiled_function(compiled_function)
+    , m_allocator(allocator)
 {
     const auto envConcurrency = getenv_int("NGRAPH_CPU_CONCURRENCY");
     m_num_ctx = envConcurrency <= 0 ? 1 : envConcurrency;
@@ -49,6 +51,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
 
+    // Codegen keeps a single context whose pools are baked into the generated code
+    m_use_shared_memory_pool = m_external_function->is_direct_execution() &&
+                               getenv_bool("NGRAPH_CPU_SHARED_MEMORY_POOL");
+
     setup_runtime_context(allocator);
     if (!m_external_function->is_direct_execution())
     {
@@ -80,21 +86,33 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i]);
+        // Fence on any write staged into this pipeline slot
+        tv->wait_for_read_ready();
+        auto ctx = m_ctx_vec[id];
         if (disable_caching)
         {
-            m_ctx_vec[id]->p_en[i] = true;
+            ctx->p_en[i] = true;
+            ctx->p_version[i] = 0;
         }
         else
         {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
+            // Intermediates of this context are reusable only if they were computed from the
+            // same version of the input, which another context may have consumed instead
+            ctx->p_en[i] = tv->get_stale() || ctx->p_version[i] != tv->get_version();
+            ctx->p_version[i] = tv->get_version();
         }
 
         inputs.push_back(tv->get_data_ptr());
     }
+    if (m_external_function->m_emit_timing)
+    {
+        m_external_function->record_input_changes(m_ctx_vec[id]->p_en, input_tvs.size());
+    }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(output_tvs[i]);
+        tv->wait_for_write_ready();
         outputs.push_back(tv->get_data_ptr());
     }
 
@@ -121,7 +139,6 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
     size_t id = 0;
-    auto disable_caching = false;
     {
         std::unique_lock<std::mutex> lck(m_mutex);
         while (m_num_ctx_available == 0)
@@ -139,19 +156,31 @@ void runtime::cpu::CPU_CallFrame::call(
         }
         NGRAPH_CHECK(id != m_num_ctx);
         m_id_pool[id] = false;
-        if (id != m_prev_ctx)
-        {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
-        }
-        m_prev_ctx = id;
         m_num_ctx_available--;
     }
 
     m_ctx_vec[id]->pc = 0;
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    if (m_use_shared_memory_pool)
+    {
+        // Borrowed pools do not keep intermediates from the previous call, so cached
+        // results of non-stale inputs cannot be reused
+        borrow_memory_pools(m_ctx_vec[id]);
+        try
+        {
+            inner_call(output_tvs, input_tvs, id, true);
+        }
+        catch (...)
+        {
+            return_memory_pools(m_ctx_vec[id]);
+            throw;
+        }
+        return_memory_pools(m_ctx_vec[id]);
+    }
+    else
+    {
+        inner_call(output_tvs, input_tvs, id, false);
+    }
 
     m_mutex.lock();
     m_id_pool[id] = true;
@@ -160,6 +189,30 @@ void runtime::cpu::CPU_CallFrame::call(
     m_cv.notify_one();
 }
 
+void runtime::cpu::CPU_CallFrame::borrow_memory_pools(CPURuntimeContext* ctx)
+{
+    auto& arena = SharedMemoryArena::get_instance(m_allocator);
+    const auto& buffer_sizes = m_external_function->get_memory_buffer_sizes();
+    for (size_t i = 0; i < buffer_sizes.size(); i++)
+    {
+        ctx->memory_buffers[i] = arena.acquire(buffer_sizes[i]);
+    }
+    ctx->scratchpad_buffer =
+        arena.acquire(m_external_function->get_dnnl_emitter()->get_max_scratchpad_size());
+}
+
+void runtime::cpu::CPU_CallFrame::return_memory_pools(CPURuntimeContext* ctx)
+{
+    auto& arena = SharedMemoryArena::get_instance(m_allocator);
+    for (auto& buffer : ctx->memory_buffers)
+    {
+        arena.release(buffer);
+        buffer = nullptr;
+    }
+    arena.release(ctx->scratchpad_buffer);
+    ctx->scratchpad_buffer = nullptr;
+}
+
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
     const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
     const LayoutDescriptorPtrs& layouts) const
@@ -194,7 +247,10 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         {
             ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
         }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+        auto num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+        ctx->p_en = new bool[num_inputs];
+        ctx->p_version = new size_t[num_inputs]();
+        ctx->t_en = new bool[m_external_function->get_stale_tensor_count()]();
 
         ctx->first_iteration = true;
 
@@ -202,9 +258,13 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 
         // Create temporary buffer pools
         size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+        ctx->shared_memory_pool = m_use_shared_memory_pool;
         for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
+            // Shared pools are borrowed from the arena at call time
+            auto buffer = m_use_shared_memory_pool
+                              ? nullptr
+                              : new AlignedBuffer(buffer_size, alignment, allocator);
             ctx->memory_buffers.push_back(buffer);
         }
         const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
@@ -218,7 +278,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
                 std::vector<dnnl::memory*>(dnnl_emitter->get_dnnl_memories().size());
             ctx->dnnl_scratchpad_mds =
                 std::vector<dnnl::memory::desc*>(dnnl_emitter->get_dnnl_scratchpad_mds().size());
-            if (scratchpad_size > 0)
+            if (scratchpad_size > 0 && !m_use_shared_memory_pool)
             {
                 ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
             }
@@ -259,6 +319,8 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 
         delete[] ctx->op_durations;
         delete[] ctx->p_en;
+        delete[] ctx->p_version;
+        delete[] ctx->t_en;
         for (auto p : ctx->dnnl_primitives)
         {
             delete p;
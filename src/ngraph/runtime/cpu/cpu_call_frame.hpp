@@ -87,15 +87,18 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                void borrow_memory_pools(CPURuntimeContext* ctx);
+                void return_memory_pools(CPURuntimeContext* ctx);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
                 std::mutex m_mutex;
                 std::condition_variable m_cv;
                 volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
                 size_t m_num_ctx = 1;
                 std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                bool m_use_shared_memory_pool = false;
 
                 // Codegen specific
 
@@ -107,6 +110,9 @@ namespace ngraph
 
                 EntryPoint m_compiled_function;
 
+                /// Allocator of the intermediate pools; also selects the shared arena
+                runtime::Allocator* m_allocator;
+
                 /// Execution context used in codegen mode.
                 CPURuntimeContextCG* cg_ctx = nullptr;
             };
@@ -41,6 +41,10 @@ void runtime::cpu::CPU_CountTracepoint::operator()(void** outputs, const std::st
 runtime::cpu::CPU_Debugger::CPU_Debugger(ngraph::runtime::cpu::CPU_CallFrame& callframe)
     : m_callframe(callframe)
 {
+    // Stepping resumes across calls and reads intermediates between them, which a pool
+    // handed back to the shared arena after every call cannot provide
+    NGRAPH_CHECK(!m_callframe.m_use_shared_memory_pool,
+                 "CPU_Debugger is not supported with NGRAPH_CPU_SHARED_MEMORY_POOL");
 }
 
 runtime::cpu::CPU_Debugger::~CPU_Debugger() {}
@@ -114,8 +114,10 @@
 #include "ngraph/runtime/cpu/cpu_kernel_emitters.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast_binary.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -127,10 +129,12 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/state/kv_cache_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
@@ -4028,6 +4032,183 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::OptimizerUpdate)
+            {
+                (void)external_function;
+                using Algorithm = ngraph::op::OptimizerUpdate::Algorithm;
+                auto update = static_cast<const ngraph::op::OptimizerUpdate*>(node);
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type for OptimizerUpdate");
+                }
+
+                const auto algorithm = update->get_algorithm();
+                const size_t states = ngraph::op::OptimizerUpdate::get_state_count(algorithm);
+
+                writer.block_begin();
+                writer << "const float lr = " << to_cpp_string(update->get_learning_rate())
+                       << ";\n";
+                writer << "const float beta1 = " << to_cpp_string(update->get_beta1()) << ";\n";
+                writer << "const float beta2 = " << to_cpp_string(update->get_beta2()) << ";\n";
+                writer << "const float eps = " << to_cpp_string(update->get_epsilon()) << ";\n";
+                writer << "const float wd = " << to_cpp_string(update->get_weight_decay())
+                       << ";\n";
+                for (size_t p = 0; p < update->get_parameter_count(); p++)
+                {
+                    const std::string param = args[p * (states + 2)].get_name();
+                    const std::string grad = args[p * (states + 2) + 1].get_name();
+                    const std::string m = args[p * (states + 2) + 2].get_name();
+                    const std::string out_param = out[p * (states + 1)].get_name();
+                    const std::string out_m = out[p * (states + 1) + 1].get_name();
+                    const size_t size = out[p * (states + 1)].get_size();
+
+                    writer.block_begin();
+                    if (algorithm == Algorithm::SGDMomentum)
+                    {
+                        writer << "#pragma omp parallel for simd\n";
+                        writer << "for (size_t i = 0; i < " << size << "; i++)\n";
+                        writer.block_begin();
+                        writer << "float v = beta1 * " << m << "[i] + " << grad << "[i] + wd * "
+                               << param << "[i];\n";
+                        writer << out_m << "[i] = v;\n";
+                        writer << out_param << "[i] = " << param << "[i] - lr * v;\n";
+                        writer.block_end();
+                        writer.block_end();
+                        continue;
+                    }
+
+                    const std::string v = args[p * (states + 2) + 3].get_name();
+                    const std::string out_v = out[p * (states + 1) + 2].get_name();
+                    const bool lamb = algorithm == Algorithm::Lamb;
+                    if (lamb)
+                    {
+                        writer << "float param_norm = 0;\n";
+                        writer << "float step_norm = 0;\n";
+                        writer << "#pragma omp parallel for simd reduction(+ : param_norm, "
+                                  "step_norm)\n";
+                    }
+                    else
+                    {
+                        writer << "#pragma omp parallel for simd\n";
+                    }
+                    writer << "for (size_t i = 0; i < " << size << "; i++)\n";
+                    writer.block_begin();
+                    writer << "float g = " << grad << "[i];\n";
+                    writer << "float m = beta1 * " << m << "[i] + (1 - beta1) * g;\n";
+                    writer << "float v = beta2 * " << v << "[i] + (1 - beta2) * g * g;\n";
+                    writer << out_m << "[i] = m;\n";
+                    writer << out_v << "[i] = v;\n";
+                    writer << "float step = m / (sqrt(v) + eps) + wd * " << param
+                           << "[i];\n";
+                    if (lamb)
+                    {
+                        writer << "param_norm += " << param << "[i] * " << param << "[i];\n";
+                        writer << "step_norm += step * step;\n";
+                    }
+                    else
+                    {
+                        writer << out_param << "[i] = " << param << "[i] - lr * step;\n";
+                    }
+                    writer.block_end();
+
+                    if (lamb)
+                    {
+                        writer << "float rate = (param_norm > 0 && step_norm > 0) ? lr * "
+                                  "sqrt(param_norm) / sqrt(step_norm) : lr;\n";
+                        writer << "#pragma omp parallel for simd\n";
+                        writer << "for (size_t i = 0; i < " << size << "; i++)\n";
+                        writer.block_begin();
+                        writer << out_param << "[i] = " << param << "[i] - rate * (" << out_m
+                               << "[i] / (sqrt(" << out_v << "[i]) + eps) + wd * " << param
+                               << "[i]);\n";
+                        writer.block_end();
+                    }
+                    writer.block_end();
+                }
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::CachedAttention)
+            {
+                auto attention = static_cast<const ngraph::op::CachedAttention*>(node);
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported element type for CachedAttention");
+                }
+
+                const auto& key_shape = args[1].get_shape();
+                size_t value_dim = args[2].get_shape()[2];
+                auto index = external_function->add_state(
+                    new ngraph::KVCacheState(key_shape[0],
+                                             attention->get_max_length(),
+                                             key_shape[2] * sizeof(float),
+                                             value_dim * sizeof(float)));
+
+                writer.block_begin();
+                writer << "auto state = static_cast<ngraph::KVCacheState*>(ctx->states[" << index
+                       << "]);\n";
+                if (attention->has_positions())
+                {
+                    writer << "int64_t positions = " << args[3].get_name() << "[0];\n";
+                    writer << "if (positions < 0 || positions > " << key_shape[1] << ")\n";
+                    writer.block_begin();
+                    writer << "throw std::out_of_range(\"CachedAttention positions\");\n";
+                    writer.block_end();
+                }
+                else
+                {
+                    writer << "int64_t positions = " << key_shape[1] << ";\n";
+                }
+                writer << "cpu::kernel::cached_attention<float>(" << args[0].get_name() << ",\n";
+                writer << "                                     " << args[1].get_name() << ",\n";
+                writer << "                                     " << args[2].get_name() << ",\n";
+                writer << "                                     " << out[0].get_name() << ",\n";
+                writer << "                                     state,\n";
+                writer << "                                     " << key_shape[0] << ",\n";
+                writer << "                                     positions,\n";
+                writer << "                                     " << key_shape[1] << ",\n";
+                writer << "                                     " << key_shape[2] << ",\n";
+                writer << "                                     " << value_dim << ",\n";
+                writer << "                                     " << attention->get_scale()
+                       << ",\n";
+                writer << "                                     0);\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::BroadcastBinary)
+            {
+                using Kind = ngraph::op::BroadcastBinary::Kind;
+                auto binary = static_cast<const ngraph::op::BroadcastBinary*>(node);
+                string kernel;
+                switch (binary->get_kind())
+                {
+                case Kind::Add: kernel = "broadcast_add"; break;
+                case Kind::Subtract: kernel = "broadcast_subtract"; break;
+                case Kind::Multiply: kernel = "broadcast_multiply"; break;
+                case Kind::Divide: kernel = "broadcast_divide"; break;
+                case Kind::Maximum: kernel = "broadcast_maximum"; break;
+                case Kind::Minimum: kernel = "broadcast_minimum"; break;
+                }
+                auto layout = runtime::cpu::kernel::broadcast_binary::make_layout(
+                    out[0].get_shape(),
+                    binary->get_broadcast_axes0(),
+                    binary->get_broadcast_axes1());
+
+                writer.block_begin();
+                writer << "static const cpu::kernel::broadcast_binary::Layout layout{\n";
+                writer << "    std::vector<size_t>{" << join(layout.shape) << "},\n";
+                writer << "    std::vector<size_t>{" << join(layout.strides0) << "},\n";
+                writer << "    std::vector<size_t>{" << join(layout.strides1) << "}};\n";
+                writer << "cpu::kernel::" << kernel << "<"
+                       << out[0].get_element_type().c_type_string() << ">(" << args[0].get_name()
+                       << ", " << args[1].get_name() << ", " << out[0].get_name()
+                       << ", layout, 0);\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::v0::Softmax)
             {
@@ -25,12 +25,15 @@
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
+#include "ngraph/runtime/cpu/op/cached_attention.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -300,6 +303,12 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::SigmoidMultiplyBackprop);
             template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::OptimizerUpdate);
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::CachedAttention);
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::BroadcastBinary);
+            template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::v0::Softmax);
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::v0::Result);
@@ -31,6 +31,7 @@
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -45,10 +46,12 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              Allocator* allocator,
                                              bool performance_counters_enabled,
-                                             EXECUTION_MODE mode)
+                                             EXECUTION_MODE mode,
+                                             const ExecutionProfile& profile)
 {
     m_external_function = make_shared<CPU_ExternalFunction>(func, mode);
     m_external_function->m_emit_timing = performance_counters_enabled;
+    m_external_function->m_profile = profile;
     auto cf = m_external_function->make_call_frame(pass_config, allocator);
     m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
 
@@ -68,6 +71,11 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return true;
 }
 
+void runtime::cpu::CPU_Executable::reset_state()
+{
+    m_external_function->reset_states();
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -85,6 +93,10 @@ runtime::Allocator* runtime::cpu::CPU_Backend::get_host_memory_allocator()
 {
     if (!m_allocator)
     {
+        if (auto huge_page_allocator = runtime::get_huge_page_allocator_from_env())
+        {
+            return huge_page_allocator;
+        }
         return runtime::get_default_allocator();
     }
     return m_allocator;
@@ -111,6 +123,11 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+runtime::ExecutionProfile runtime::cpu::CPU_Executable::get_profile() const
+{
+    return m_external_function->get_profile();
+}
+
 shared_ptr<ngraph::op::v0::Parameter>
     runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
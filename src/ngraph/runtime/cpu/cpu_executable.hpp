@@ -25,6 +25,7 @@
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
 #include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
 
 namespace ngraph
 {
@@ -42,14 +43,22 @@ namespace ngraph
                                ngraph::pass::PassConfig& pass_config,
                                Allocator* allocator,
                                bool performance_counters_enabled,
-                               EXECUTION_MODE mode);
+                               EXECUTION_MODE mode,
+                               const ExecutionProfile& profile = ExecutionProfile());
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                void reset_state() override;
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Profile of the calls made so far, to be passed to CPU_Backend::compile
+                /// when the function is compiled again. Needs performance counters to be
+                /// enabled.
+                ExecutionProfile get_profile() const;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
@@ -14,12 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
 #include <thread>
+#include <vector>
 
 #include "cpu_executor.hpp"
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -68,6 +72,68 @@ static int GetNumThreadPools()
     return count < 1 ? 1 : count;
 }
 
+// Median over a few runs, in nanoseconds
+template <typename Body>
+static double MeasureNanoseconds(Body body)
+{
+    const int runs = 31;
+    std::vector<double> samples;
+    body();
+    for (int i = 0; i < runs; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    std::nth_element(samples.begin(), samples.begin() + runs / 2, samples.end());
+    return samples[runs / 2];
+}
+
+// Time it takes to hand one parallelFor to every thread of the pool and wait for them to finish
+static double MeasureDispatchNanoseconds(Eigen::ThreadPoolDevice& device)
+{
+    const Eigen::Index tasks = device.numThreads();
+    std::vector<int> touched(tasks, 0);
+    return MeasureNanoseconds([&]() {
+        device.parallelFor(tasks,
+                           Eigen::TensorOpCost(0, 0, 1e6),
+                           [&](Eigen::Index first, Eigen::Index last) {
+                               for (Eigen::Index i = first; i < last; i++)
+                               {
+                                   touched[i]++;
+                               }
+                           });
+    });
+}
+
+// The threshold is the amount of data a single thread streams through in the time of a dispatch
+static size_t CalibrateParallelThreshold(double dispatch_ns)
+{
+    if (dispatch_ns == 0)
+    {
+        return 0;
+    }
+
+    const size_t count = 16384;
+    std::vector<float> a(count, 1.0f);
+    std::vector<float> b(count, 0.0f);
+    double stream_ns = MeasureNanoseconds([&]() {
+        for (size_t i = 0; i < count; i++)
+        {
+            b[i] = a[i] * 0.5f + b[i];
+        }
+    });
+    // Keep the loop above from being optimized away
+    volatile float sink = b[count - 1];
+    (void)sink;
+
+    const double bytes_per_ns = 3 * count * sizeof(float) / std::max(stream_ns, 1.0);
+    const double threshold = dispatch_ns * bytes_per_ns;
+    // Guard against a noisy measurement on a busy machine
+    return static_cast<size_t>(std::min(std::max(threshold, 4096.0), 4194304.0));
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -78,6 +144,8 @@ namespace ngraph
             {
                 CPUExecutor::CPUExecutor(int num_thread_pools)
                     : m_num_thread_pools(num_thread_pools)
+                    , m_parallel_threshold(0)
+                    , m_dispatch_nanoseconds(0)
                 {
                     m_num_cores = GetNumCores();
                     for (int i = 0; i < num_thread_pools; i++)
@@ -115,6 +183,41 @@ namespace ngraph
                         m_tbb_arenas.emplace_back(1);
 #endif
                     }
+                    // A device with one thread runs parallelFor and tensor expressions inline
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+                        m_thread_pool_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
+                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), 1)));
+                    }
+                }
+
+                size_t CPUExecutor::get_parallel_threshold()
+                {
+                    std::call_once(m_threshold_once, [this]() {
+                        const auto threshold = getenv_int("NGRAPH_CPU_PARALLEL_THRESHOLD");
+                        if (threshold >= 0)
+                        {
+                            m_parallel_threshold = threshold;
+                        }
+                        else
+                        {
+                            m_parallel_threshold =
+                                CalibrateParallelThreshold(get_dispatch_nanoseconds());
+                            NGRAPH_DEBUG << "CPU parallel threshold calibrated to "
+                                         << m_parallel_threshold << " bytes";
+                        }
+                    });
+                    return m_parallel_threshold;
+                }
+
+                double CPUExecutor::get_dispatch_nanoseconds()
+                {
+                    std::call_once(m_dispatch_once, [this]() {
+                        auto& device = get_device(0);
+                        m_dispatch_nanoseconds =
+                            device.numThreads() < 2 ? 0 : MeasureDispatchNanoseconds(device);
+                    });
+                    return m_dispatch_nanoseconds;
                 }
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -148,6 +251,8 @@ namespace ngraph
                     static CPUExecutor cpu_executor(num_thread_pools < 1 ? 1 : num_thread_pools);
                     return cpu_executor;
                 }
+
+                bool is_deterministic() { return getenv_bool("NGRAPH_CPU_DETERMINISTIC"); }
                 dnnl::engine global_cpu_engine(dnnl::engine::kind::cpu, 0);
             }
         }
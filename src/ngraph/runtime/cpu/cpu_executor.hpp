@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <mutex>
 #include <thread>
 
 #include <dnnl.hpp>
@@ -51,6 +52,17 @@ namespace ngraph
                         return *m_thread_pool_devices[id].get();
                     }
 
+                    // Arena whose device runs every kernel on the calling thread. It shares the
+                    // pool of arena id but never wakes its threads.
+                    int get_serial_arena(int id) const { return m_num_thread_pools + id; }
+                    // Bytes of work below which waking the pool costs more than it saves. Set
+                    // by NGRAPH_CPU_PARALLEL_THRESHOLD, or measured on first use; 0 means that
+                    // every kernel goes to the pool.
+                    size_t get_parallel_threshold();
+                    // Round trip of a parallelFor across the pool of arena 0, measured on first
+                    // use; 0 if the pool has a single thread.
+                    double get_dispatch_nanoseconds();
+
 #if defined(NGRAPH_TBB_ENABLE)
                     void execute(CPUKernelFunctor& f,
                                  CPURuntimeContext* ctx,
@@ -72,9 +84,18 @@ namespace ngraph
 #endif
                     int m_num_thread_pools;
                     int m_num_cores;
+                    std::once_flag m_threshold_once;
+                    size_t m_parallel_threshold;
+                    std::once_flag m_dispatch_once;
+                    double m_dispatch_nanoseconds;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
+
+                // True when NGRAPH_CPU_DETERMINISTIC is set. Kernels must then produce
+                // bit-identical results for any thread count and schedule. Only consulted while
+                // compiling, so the setting applies per compiled function.
+                bool is_deterministic();
             }
         }
     }
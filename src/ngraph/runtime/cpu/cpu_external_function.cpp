@@ -145,6 +145,7 @@
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
+#include "ngraph/pass/concat_fusion.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/convert_opset_1_to_0.hpp"
 #include "ngraph/pass/convert_opset_3_to_1.hpp"
@@ -161,6 +162,7 @@
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/strength_reduction.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -179,6 +181,8 @@
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
+#include "ngraph/runtime/cpu/op/cached_attention.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -190,12 +194,15 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_broadcast_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_constant_hoisting.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_dnnl_primitive_build.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
@@ -437,6 +444,9 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::v0::Product), &runtime::cpu::CPU_Emitter::emit<op::v0::Product>},
     {TI(ngraph::op::v0::Max), &runtime::cpu::CPU_Emitter::emit<op::v0::Max>},
     {TI(ngraph::op::v0::Min), &runtime::cpu::CPU_Emitter::emit<op::v0::Min>},
+    {TI(ngraph::op::OptimizerUpdate), &runtime::cpu::CPU_Emitter::emit<op::OptimizerUpdate>},
+    {TI(ngraph::op::CachedAttention), &runtime::cpu::CPU_Emitter::emit<op::CachedAttention>},
+    {TI(ngraph::op::BroadcastBinary), &runtime::cpu::CPU_Emitter::emit<op::BroadcastBinary>},
     {TI(ngraph::op::v0::Relu), &runtime::cpu::CPU_Emitter::emit<op::v0::Relu>},
     {TI(ngraph::op::v0::ReluBackprop), &runtime::cpu::CPU_Emitter::emit<op::v0::ReluBackprop>},
     {TI(ngraph::op::Rnn), &runtime::cpu::CPU_Emitter::emit<op::Rnn>},
@@ -552,9 +562,6 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #if defined(NGRAPH_TBB_ENABLE)
     writer += "#define NGRAPH_TBB_ENABLE\n";
 #endif
-#if defined(NGRAPH_CPU_MLIR_ENABLE)
-    writer += "#define NGRAPH_CPU_MLIR_ENABLE\n";
-#endif
 
     writer +=
         R"(
@@ -570,6 +577,8 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast_binary.hpp"
+#include "ngraph/runtime/cpu/kernel/cached_attention.hpp"
 #include "ngraph/runtime/reference/all.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/any.hpp"
@@ -614,6 +623,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/xor.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
+#include "ngraph/state/kv_cache_state.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/util.hpp"
 
@@ -1301,12 +1311,13 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(BatchFusion, true, ngraph::pass)
-    REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass)
+    REGISTER_KNOBBED_PASS(ReshapeSinking, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ReshapeElimination, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(RecurrentReshapeElimination, false, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
+    REGISTER_KNOBBED_PASS(ConcatSliceFusion, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(CPUPreFusion, true, runtime::cpu::pass)
 
 // Disable CPUFusion if MLIR is enabled to preserve core ops.
@@ -1314,13 +1325,35 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     if (m_execution_mode != EXECUTION_MODE::MLIR)
     {
 #endif
+        // ConvolutionBiasBackprop has no codegen emitter. Runs before CPUFusion so that it
+        // sees the backprop ops before they are fused pairwise.
+        if (m_direct_execution)
+        {
+            REGISTER_KNOBBED_PASS(CPUConvBackpropFusion, true, runtime::cpu::pass)
+        }
         REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass)
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     }
 #endif
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
+    // Runs after the fusions, whose batch norm and dropout patterns match the divides that
+    // x / c -> x * (1 / c) would rewrite. Only bitwise exact rewrites are on by default; the
+    // StrengthReduction::Approximate attribute enables rounding-changing ones and
+    // StrengthReduction::UnsafeDomain also cancels exp/log pairs.
+    ngraph::pass::StrengthReductionMask numerics = ngraph::pass::StrengthReductionType::EXACT;
+    if (pass_config.get_pass_attribute("StrengthReduction::Approximate"))
+    {
+        numerics.set(ngraph::pass::StrengthReductionType::APPROXIMATE);
+    }
+    if (pass_config.get_pass_attribute("StrengthReduction::UnsafeDomain"))
+    {
+        numerics.set(ngraph::pass::StrengthReductionType::UNSAFE_DOMAIN);
+    }
+    REGISTER_KNOBBED_PASS_WITH_ARGS(StrengthReduction, true, ngraph::pass, numerics)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(CPUOptimizerUpdateFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    REGISTER_KNOBBED_PASS(CPUBroadcastFolding, true, runtime::cpu::pass)
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     if (m_execution_mode == EXECUTION_MODE::MLIR)
@@ -1333,6 +1366,7 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(ConstantFolding, true, ngraph::pass, GetGlobalCFDispatcherCPU())
+    REGISTER_KNOBBED_PASS(CPUConstantHoisting, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPULayout, true, runtime::cpu::pass, this)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
@@ -1343,8 +1377,17 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+#if defined(NGRAPH_TBB_ENABLE)
+    bool concurrent_execution = m_use_tbb;
+#else
+    bool concurrent_execution = false;
+#endif
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        concurrent_execution);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
@@ -1363,6 +1406,34 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+// Bytes a kernel reads and writes. Dot also does one multiply-add per reduced element of each
+// output, which is counted like traffic.
+static size_t estimate_work(const Node* node,
+                            const vector<runtime::cpu::TensorWrapper>& in,
+                            const vector<runtime::cpu::TensorWrapper>& out)
+{
+    size_t work = 0;
+    for (auto& tw : in)
+    {
+        work += tw.get_size() * tw.get_element_type().size();
+    }
+    for (auto& tw : out)
+    {
+        work += tw.get_size() * tw.get_element_type().size();
+    }
+    if (auto dot = as_type<const ngraph::op::v0::Dot>(node))
+    {
+        const auto& shape = in[0].get_shape();
+        size_t reduced = 1;
+        for (size_t i = shape.size() - dot->get_reduction_axes_count(); i < shape.size(); i++)
+        {
+            reduced *= shape[i];
+        }
+        work += out[0].get_size() * reduced * out[0].get_element_type().size();
+    }
+    return work;
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1581,7 +1652,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             descriptor::Tensor& output_tensor = param->get_output_tensor(i);
             auto tensor_set = get_tensor_set(&output_tensor);
 
-            auto& stale = tensor_stale[output_tensor.get_name()];
+            auto stale = tensor_stale_index
+                             .emplace(output_tensor.get_name(), tensor_stale_index.size())
+                             .first->second;
             // process all tensors in the set containing the output tensor of the parameter
             for (auto& ele_t : tensor_set)
             {
@@ -1618,6 +1691,24 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    const size_t parallel_threshold = executor::GetCPUExecutor().get_parallel_threshold();
+    // A recorded profile overrides the work estimate where measured times clearly disagree
+    // with it. The margins keep ops near the break-even point from flipping between runs. The
+    // profile was passed for this function only, and is still ignored unless it was recorded
+    // for the same ops.
+    NodeVector profiled_ops;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (!node->is_parameter() && !node->is_constant())
+        {
+            profiled_ops.push_back(node);
+        }
+    }
+    const bool use_profile = !m_profile.get_ops().empty() &&
+                             m_profile.get_function_hash() ==
+                                 ExecutionProfile::get_function_hash(profiled_ops);
+    const double dispatch_us =
+        use_profile ? executor::GetCPUExecutor().get_dispatch_nanoseconds() / 1e3 : 0;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1659,6 +1750,31 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         op_names.push_back(node->get_name());
         handler->second(this, node.get(), in, out);
 
+        // Small kernels run on the calling thread, where they do not wait for the pool to wake
+        auto work = estimate_work(node.get(), in, out);
+        bool serial = work < parallel_threshold;
+        auto recorded = m_profile.find(m_perf_counters.size(), *node);
+        if (recorded && recorded->call_count > 0 && dispatch_us > 0)
+        {
+            if (recorded->serial && recorded->microseconds() > 4 * dispatch_us)
+            {
+                serial = false;
+            }
+            else if (!recorded->serial && recorded->microseconds() < 2 * dispatch_us)
+            {
+                serial = true;
+            }
+        }
+        if (serial)
+        {
+            auto kernel = functors.back();
+            functors.back() = [kernel](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                CPUExecutionContext serial{
+                    executor::GetCPUExecutor().get_serial_arena(ectx->arena)};
+                kernel(ctx, &serial);
+            };
+        }
+
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                             pass_config.get_pass_attribute("ReuseMemory");
@@ -1674,56 +1790,46 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
             || computes_result(node.get()) || possibly_overwritten(node.get()) || node->has_state();
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        auto stale_index = [&](const string& name) {
+            const string& key = tensor_alias.count(name) ? tensor_alias[name] : name;
+            return tensor_stale_index.emplace(key, tensor_stale_index.size()).first->second;
+        };
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
-            if (tensor_alias.count(name))
-            {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
-            }
-            else
-            {
-                in_stale.emplace_back(tensor_stale[name]);
-            }
+            in_stale.push_back(stale_index(name));
         }
         for (const auto& name : out_names)
         {
-            if (tensor_alias.count(name))
-            {
-                out_stale.emplace_back(tensor_stale[tensor_alias[name]]);
-            }
-            else
-            {
-                out_stale.emplace_back(tensor_stale[name]);
-            }
+            out_stale.push_back(stale_index(name));
         }
 
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
-            enable = [in_stale, out_stale](CPURuntimeContext * /* ctx */) -> bool {
-                for (auto& stale : out_stale)
+            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
+                for (auto stale : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->t_en[stale] = true;
                 }
                 return true;
             };
         }
         else
         {
-            enable = [in_stale, out_stale](CPURuntimeContext * /* ctx */) -> bool {
+            enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (auto stale : in_stale)
                 {
-                    if (stale)
+                    if (ctx->t_en[stale])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->t_en[stale] = en;
                 }
                 return en;
             };
@@ -1733,6 +1839,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
 
         m_perf_counters.emplace_back(node, 0, 0);
+        m_perf_counters.back().m_work_estimate = work;
+        m_perf_counters.back().m_parallel_threshold = parallel_threshold;
+        m_perf_counters.back().m_serial = serial;
     }
 
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
@@ -1802,14 +1911,17 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
 
-        if (ctx->first_iteration)
+        if (ctx->first_iteration || ctx->shared_memory_pool)
         {
             for (auto& p : intermediates_offsets)
             {
                 ctx->buffer_data[p.first] =
                     static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
             }
+        }
 
+        if (ctx->first_iteration)
+        {
             for (auto& p : constant_tensor_data)
             {
                 ctx->buffer_data[p.first] = p.second;
@@ -1819,7 +1931,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         for (const auto& p : function_input_index_offset)
         {
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-            get<3>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->t_en[get<3>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index_offset)
@@ -2163,6 +2275,26 @@ const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::g
     return m_perf_counters;
 }
 
+runtime::ExecutionProfile runtime::cpu::CPU_ExternalFunction::get_profile()
+{
+    ExecutionProfile profile(get_perf_counters());
+    lock_guard<mutex> lock(m_profile_mutex);
+    profile.set_call_count(m_call_count);
+    profile.set_input_change_counts(m_input_change_counts);
+    return profile;
+}
+
+void runtime::cpu::CPU_ExternalFunction::record_input_changes(const bool* changed, size_t count)
+{
+    lock_guard<mutex> lock(m_profile_mutex);
+    m_input_change_counts.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        m_input_change_counts[i] += changed[i];
+    }
+    m_call_count++;
+}
+
 void runtime::cpu::CPU_ExternalFunction::write_to_file(const std::string& code,
                                                        const std::string& directory,
                                                        const std::string& filename)
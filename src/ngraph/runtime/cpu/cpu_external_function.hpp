@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -45,6 +46,7 @@
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
 #include "ngraph/util.hpp"
@@ -129,6 +131,7 @@ namespace ngraph
                     return m_memory_buffer_sizes;
                 }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                size_t get_stale_tensor_count() const { return tensor_stale_index.size(); }
                 const std::unique_ptr<DNNLEmitter>& get_dnnl_emitter() const
                 {
                     return m_dnnl_emitter;
@@ -153,6 +156,13 @@ namespace ngraph
                     m_states.push_back(state);
                     return m_states.size() - 1;
                 }
+                void reset_states()
+                {
+                    for (auto state : m_states)
+                    {
+                        state->reset();
+                    }
+                }
 
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
@@ -180,6 +190,10 @@ namespace ngraph
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
+                /// Profile of the calls made so far, with performance counters enabled
+                ExecutionProfile get_profile();
+                /// Counts a call in which the inputs flagged in changed held new data
+                void record_input_changes(const bool* changed, size_t count);
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -241,6 +255,8 @@ namespace ngraph
 
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_emit_timing;
+                // Profile of an earlier run of this function, empty if none was given
+                ExecutionProfile m_profile;
 
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
@@ -284,7 +300,9 @@ namespace ngraph
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
                 // get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
-                std::unordered_map<std::string, bool> tensor_stale;
+                // name of a tensor and index into the cpu_runtime_context's t_en array that
+                // tracks whether the tensor changed in the current call
+                std::unordered_map<std::string, size_t> tensor_stale_index;
                 // Each tensor is put into one buffer set.
                 // All the tensors in the same buffer set share the same memory buffer.
                 // bufferID_to_tensorSets maps bufferID to the pair of TensorRole and buffer set.
@@ -307,10 +325,9 @@ namespace ngraph
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // input index, offset into the input, and if the input is stale
-                // used to calculate the correct address at runtime
-                std::list<std::tuple<size_t, size_t, size_t, std::reference_wrapper<bool>>>
-                    function_input_index_offset;
+                // input index, offset into the input, and index into the cpu_runtime_context's
+                // t_en array. used to calculate the correct address at runtime
+                std::list<std::tuple<size_t, size_t, size_t, size_t>> function_input_index_offset;
                 // index to the cpu_runtime_context's buffer_data vector to get a tensor,
                 // output index, and offset into the output.
                 // used to calculate the correct address at runtime
@@ -320,6 +337,10 @@ namespace ngraph
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                // Updated by every execution context, so guarded by m_profile_mutex
+                size_t m_call_count = 0;
+                std::vector<size_t> m_input_change_counts;
+                std::mutex m_profile_mutex;
 
                 /// Map each node with dnnl implementation to its dnnl primitive creating
                 /// string, deps, dnnl primitive index, and dnnl scratchpad size.
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_arena.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::SharedMemoryArena&
+    runtime::cpu::SharedMemoryArena::get_instance(Allocator* allocator)
+{
+    // Never destroyed so that call frames torn down during static destruction can still
+    // return their buffers
+    static mutex* arenas_mutex = new mutex;
+    static unordered_map<Allocator*, SharedMemoryArena*>* arenas =
+        new unordered_map<Allocator*, SharedMemoryArena*>;
+
+    lock_guard<mutex> lock(*arenas_mutex);
+    auto& arena = (*arenas)[allocator];
+    if (arena == nullptr)
+    {
+        arena = new SharedMemoryArena(allocator, CPU_ExternalFunction::s_memory_pool_alignment);
+    }
+    return *arena;
+}
+
+runtime::cpu::SharedMemoryArena::SharedMemoryArena(Allocator* allocator, size_t alignment)
+    : m_allocator(allocator)
+    , m_alignment(alignment)
+{
+}
+
+runtime::cpu::SharedMemoryArena::~SharedMemoryArena()
+{
+}
+
+runtime::AlignedBuffer* runtime::cpu::SharedMemoryArena::acquire(size_t size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+
+    // Best fit among the idle buffers
+    auto best = m_free_buffers.end();
+    for (auto it = m_free_buffers.begin(); it != m_free_buffers.end(); ++it)
+    {
+        if ((*it)->size() >= size &&
+            (best == m_free_buffers.end() || (*it)->size() < (*best)->size()))
+        {
+            best = it;
+        }
+    }
+
+    AlignedBuffer* buffer = nullptr;
+    if (best != m_free_buffers.end())
+    {
+        buffer = *best;
+        m_free_buffers.erase(best);
+    }
+    else if (!m_free_buffers.empty())
+    {
+        // Every idle buffer is too small. Grow the largest one instead of adding another so
+        // that the arena holds at most one buffer per concurrent borrower.
+        auto largest =
+            max_element(m_free_buffers.begin(),
+                        m_free_buffers.end(),
+                        [](AlignedBuffer* a, AlignedBuffer* b) { return a->size() < b->size(); });
+        AlignedBuffer* grown = *largest;
+        auto owner = find_if(m_buffers.begin(),
+                             m_buffers.end(),
+                             [&](const unique_ptr<AlignedBuffer>& b) { return b.get() == grown; });
+        m_free_buffers.erase(largest);
+        owner->reset(new AlignedBuffer(size, m_alignment, m_allocator));
+        buffer = owner->get();
+    }
+    else
+    {
+        m_buffers.emplace_back(new AlignedBuffer(size, m_alignment, m_allocator));
+        buffer = m_buffers.back().get();
+    }
+    return buffer;
+}
+
+void runtime::cpu::SharedMemoryArena::release(AlignedBuffer* buffer)
+{
+    if (buffer == nullptr)
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    NGRAPH_CHECK(find(m_free_buffers.begin(), m_free_buffers.end(), buffer) ==
+                     m_free_buffers.end(),
+                 "Buffer returned to the shared memory arena twice");
+    m_free_buffers.push_back(buffer);
+}
+
+size_t runtime::cpu::SharedMemoryArena::get_reserved_size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t total = 0;
+    for (auto& buffer : m_buffers)
+    {
+        total += buffer->size();
+    }
+    return total;
+}
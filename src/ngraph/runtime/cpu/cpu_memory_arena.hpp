@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Process-wide pool of scratch buffers shared by all CPU executables.
+            ///
+            /// When NGRAPH_CPU_SHARED_MEMORY_POOL is set, call frames do not own their
+            /// intermediate pool and DNNL scratchpad. They borrow buffers from this arena for
+            /// the duration of a call and return them afterwards, so the number of buffers
+            /// tracks the peak number of concurrent borrowers rather than the number of
+            /// loaded executables.
+            class SharedMemoryArena
+            {
+            public:
+                /// \brief Returns the arena whose buffers come from `allocator`. There is one
+                ///        arena per allocator, so executables only share buffers with those
+                ///        that use the same allocator. A null allocator selects ngraph_malloc,
+                ///        like AlignedBuffer. The allocator must outlive every buffer taken
+                ///        from its arena.
+                static SharedMemoryArena& get_instance(Allocator* allocator);
+
+                SharedMemoryArena(Allocator* allocator, size_t alignment);
+                ~SharedMemoryArena();
+
+                /// \brief Borrows a buffer of at least `size` bytes. Returns nullptr if `size`
+                ///        is zero. The contents of the buffer are unspecified.
+                AlignedBuffer* acquire(size_t size);
+
+                /// \brief Returns a buffer obtained from acquire(). nullptr is ignored.
+                void release(AlignedBuffer* buffer);
+
+                /// \brief Total number of bytes currently held by the arena
+                size_t get_reserved_size();
+
+            private:
+                SharedMemoryArena(const SharedMemoryArena&) = delete;
+                SharedMemoryArena& operator=(const SharedMemoryArena&) = delete;
+
+                Allocator* m_allocator;
+                size_t m_alignment;
+                std::mutex m_mutex;
+                std::vector<std::unique_ptr<AlignedBuffer>> m_buffers;
+                std::vector<AlignedBuffer*> m_free_buffers;
+            };
+        }
+    }
+}
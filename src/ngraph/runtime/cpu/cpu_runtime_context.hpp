@@ -27,16 +27,6 @@
 #include <tbb/global_control.h>
 #endif
 
-#include "ngraph/op/experimental/compiled_kernel.hpp"
-
-#ifdef NGRAPH_IN_CODEGEN
-#undef NGRAPH_CPU_MLIR_ENABLE
-#endif
-
-#ifdef NGRAPH_CPU_MLIR_ENABLE
-#include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
-#endif
-
 namespace dnnl
 {
     struct primitive;
@@ -66,6 +56,11 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                // data version of each input when this context last computed from it
+                size_t* p_version;
+                // staleness of each tracked tensor, kept per context since each context
+                // holds its own intermediates
+                bool* t_en;
                 bool first_iteration;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
@@ -74,6 +69,9 @@ namespace ngraph
                 std::vector<AlignedBuffer*> memory_buffers;
                 std::vector<dnnl::memory::desc*> dnnl_scratchpad_mds;
                 AlignedBuffer* scratchpad_buffer;
+                // memory_buffers and scratchpad_buffer are borrowed from the
+                // SharedMemoryArena for each call and must be rebound every time
+                bool shared_memory_pool;
                 std::vector<char*> dnnl_workspaces;
 #if defined(NGRAPH_TBB_ENABLE)
                 tbb::flow::graph* G;
@@ -82,14 +80,6 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
-#ifdef NGRAPH_CPU_MLIR_ENABLE
-                /// Maps CompiledKernel nodes to their MLIR compiler
-                /// The MLIR compiler caches the compiled code on the first invocation,
-                /// and may in the future support re-compilation
-                std::unordered_map<ngraph::op::v0::CompiledKernel*,
-                                   ngraph::runtime::ngmlir::MLIRCPURuntime>
-                    mlir_runtimes;
-#endif
             };
             }
 
@@ -79,6 +79,8 @@ runtime::cpu::CPUTensor::CPUTensor(const ngraph::element::Type& element_type, co
 
 runtime::cpu::CPUTensor::~CPUTensor()
 {
+    // A staged write may still target this buffer
+    wait_for_pending_write_nothrow();
     ngraph_free(buffer);
 }
 
@@ -94,6 +96,7 @@ const char* runtime::cpu::CPUTensor::get_data_ptr() const
 
 void runtime::cpu::CPUTensor::write(const void* source, size_t n)
 {
+    wait_for_pending_write();
     if (n > buffer_size)
     {
         throw out_of_range("write access past end of tensor");
@@ -104,6 +107,7 @@ void runtime::cpu::CPUTensor::write(const void* source, size_t n)
 
 void runtime::cpu::CPUTensor::read(void* target, size_t n) const
 {
+    wait_for_pending_write();
     if (n > buffer_size)
     {
         throw out_of_range("read access past end of tensor");
@@ -167,6 +171,8 @@ void runtime::cpu::CPUTensor::copy_from(const ngraph::runtime::Tensor& source)
         throw invalid_argument("runtime::cpu::CPUTensor::copy_from element types must match");
     }
 
+    wait_for_pending_write();
+
     if (auto cpu_source = dynamic_cast<const runtime::cpu::CPUTensor*>(&source))
     {
         auto this_tl =
@@ -176,6 +182,7 @@ void runtime::cpu::CPUTensor::copy_from(const ngraph::runtime::Tensor& source)
         if ((this_tl != nullptr) && (other_tl != nullptr) && (*this_tl == *other_tl))
         {
             // Direct copy
+            cpu_source->wait_for_pending_write();
             memcpy(get_data_ptr(), cpu_source->get_data_ptr(), get_size_in_bytes());
         }
         else
@@ -42,6 +42,7 @@
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
@@ -256,6 +257,112 @@ dnnl::eltwise_backward::desc DNNLEmitter::get_relu_backward_desc(const ngraph::N
         dnnl::algorithm::eltwise_relu, result_desc, input_desc, negative_slope);
 }
 
+// Strides, dilations and padding of op::ConvolutionBiasBackprop in DNNL terms. DNNL wants
+// the number of elements inserted between taps as dilation, hence the minus one.
+struct ConvBiasBackpropParams
+{
+    ConvBiasBackpropParams(const ngraph::Node* node)
+    {
+        auto convolution = static_cast<const ngraph::op::ConvolutionBiasBackprop*>(node);
+        auto& movement_strides = convolution->get_window_movement_strides_forward();
+        auto& padding_below = convolution->get_padding_below_forward();
+        auto& padding_above = convolution->get_padding_above_forward();
+        strides = dnnl::memory::dims(movement_strides.begin(), movement_strides.end());
+        for (size_t s : convolution->get_window_dilation_strides_forward())
+        {
+            dilations.push_back(s - 1);
+        }
+        pad_below = dnnl::memory::dims(padding_below.begin(), padding_below.end());
+        pad_above = dnnl::memory::dims(padding_above.begin(), padding_above.end());
+    }
+
+    dnnl::memory::dims strides;
+    dnnl::memory::dims dilations;
+    dnnl::memory::dims pad_below;
+    dnnl::memory::dims pad_above;
+};
+
+dnnl::convolution_backward_data::desc
+    DNNLEmitter::get_convolution_bias_backprop_data_desc(const ngraph::Node* node)
+{
+    ConvBiasBackpropParams params(node);
+    return dnnl::convolution_backward_data::desc(dnnl_utils::get_conv_algo(),
+                                                 dnnl_utils::get_output_dnnl_md(node, 0),
+                                                 dnnl_utils::get_input_dnnl_md(node, 1),
+                                                 dnnl_utils::get_input_dnnl_md(node, 2),
+                                                 params.strides,
+                                                 params.dilations,
+                                                 params.pad_below,
+                                                 params.pad_above PADDING);
+}
+
+dnnl::convolution_forward::desc
+    DNNLEmitter::get_convolution_bias_backprop_data_fwd_desc(const ngraph::Node* node)
+{
+    ConvBiasBackpropParams params(node);
+    return dnnl::convolution_forward::desc(dnnl::prop_kind::forward,
+                                           dnnl_utils::get_conv_algo(),
+                                           dnnl_utils::get_output_dnnl_md(node, 0),
+                                           dnnl_utils::get_input_dnnl_md(node, 1),
+                                           dnnl_utils::get_input_dnnl_md(node, 2),
+                                           params.strides,
+                                           params.dilations,
+                                           params.pad_below,
+                                           params.pad_above PADDING);
+}
+
+dnnl::convolution_backward_weights::desc
+    DNNLEmitter::get_convolution_bias_backprop_weights_desc(const ngraph::Node* node)
+{
+    ConvBiasBackpropParams params(node);
+    return dnnl::convolution_backward_weights::desc(dnnl_utils::get_conv_algo(),
+                                                    dnnl_utils::get_input_dnnl_md(node, 0),
+                                                    dnnl_utils::get_output_dnnl_md(node, 1),
+                                                    dnnl_utils::get_output_dnnl_md(node, 2),
+                                                    dnnl_utils::get_input_dnnl_md(node, 2),
+                                                    params.strides,
+                                                    params.dilations,
+                                                    params.pad_below,
+                                                    params.pad_above PADDING);
+}
+
+dnnl::convolution_forward::desc
+    DNNLEmitter::get_convolution_bias_backprop_weights_fwd_desc(const ngraph::Node* node)
+{
+    ConvBiasBackpropParams params(node);
+    return dnnl::convolution_forward::desc(dnnl::prop_kind::forward,
+                                           dnnl_utils::get_conv_algo(),
+                                           dnnl_utils::get_input_dnnl_md(node, 0),
+                                           dnnl_utils::get_output_dnnl_md(node, 1),
+                                           dnnl_utils::get_output_dnnl_md(node, 2),
+                                           dnnl_utils::get_input_dnnl_md(node, 2),
+                                           params.strides,
+                                           params.dilations,
+                                           params.pad_below,
+                                           params.pad_above PADDING);
+}
+
+dnnl::eltwise_backward::desc
+    DNNLEmitter::get_convolution_bias_backprop_relu_desc(const ngraph::Node* node)
+{
+    // The masked delta has the layout of the delta it replaces
+    const float negative_slope = 0.0f;
+    return dnnl::eltwise_backward::desc(dnnl::algorithm::eltwise_relu,
+                                        dnnl_utils::get_input_dnnl_md(node, 2),
+                                        dnnl_utils::get_input_dnnl_md(node, 3),
+                                        negative_slope);
+}
+
+dnnl::eltwise_forward::desc
+    DNNLEmitter::get_convolution_bias_backprop_relu_fwd_desc(const ngraph::Node* node)
+{
+    const float negative_slope = 0.0f;
+    return dnnl::eltwise_forward::desc(dnnl::prop_kind::forward,
+                                       dnnl::algorithm::eltwise_relu,
+                                       dnnl_utils::get_input_dnnl_md(node, 3),
+                                       negative_slope);
+}
+
 dnnl::eltwise_forward::desc DNNLEmitter::get_sigmoid_forward_desc(const ngraph::Node* node,
                                                                   bool backward_op)
 {
@@ -941,6 +1048,25 @@ void DNNLEmitter::build_relu_backward(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl_primitives[relu_index] = new dnnl::eltwise_backward(relu_bwd_pd);
 }
 
+void DNNLEmitter::build_convolution_bias_backprop_relu(
+    std::vector<dnnl::memory*>& dnnl_memories,
+    std::vector<dnnl::primitive*>& dnnl_primitives,
+    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+    std::vector<char*>& dnnl_workspaces,
+    const dnnl::eltwise_backward::desc& bwd_desc,
+    const dnnl::eltwise_forward::desc& fwd_desc,
+    std::vector<size_t>& deps,
+    size_t relu_index)
+{
+    build_relu_backward(
+        dnnl_memories, dnnl_primitives, dnnl_scratchpad_mds, bwd_desc, fwd_desc, deps, relu_index);
+
+    // The masked delta lives only between the relu and the two convolutions
+    auto masked_delta_size = dnnl_memories[deps[2]]->get_desc().get_size();
+    auto workspace = std::unique_ptr<DNNLWorkspace>(new DNNLWorkspace(masked_delta_size));
+    deps[3] = insert_workspace(dnnl_workspaces, workspace);
+}
+
 void DNNLEmitter::build_sigmoid_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                         std::vector<dnnl::primitive*>& dnnl_primitives,
                                         std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
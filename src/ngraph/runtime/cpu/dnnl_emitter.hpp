@@ -454,6 +454,26 @@ namespace ngraph
 
                 dnnl::eltwise_backward::desc get_relu_backward_desc(const ngraph::Node* node);
 
+                // op::ConvolutionBiasBackprop runs a backward data and a backward weights
+                // convolution, and optionally a relu backprop, all reading the delta (input 2)
+                dnnl::convolution_backward_data::desc
+                    get_convolution_bias_backprop_data_desc(const ngraph::Node* node);
+
+                dnnl::convolution_forward::desc
+                    get_convolution_bias_backprop_data_fwd_desc(const ngraph::Node* node);
+
+                dnnl::convolution_backward_weights::desc
+                    get_convolution_bias_backprop_weights_desc(const ngraph::Node* node);
+
+                dnnl::convolution_forward::desc
+                    get_convolution_bias_backprop_weights_fwd_desc(const ngraph::Node* node);
+
+                dnnl::eltwise_backward::desc
+                    get_convolution_bias_backprop_relu_desc(const ngraph::Node* node);
+
+                dnnl::eltwise_forward::desc
+                    get_convolution_bias_backprop_relu_fwd_desc(const ngraph::Node* node);
+
                 dnnl::eltwise_forward::desc get_sigmoid_forward_desc(const ngraph::Node* node,
                                                                      bool backward_op);
 
@@ -1080,6 +1100,20 @@ namespace ngraph
                                          const std::vector<size_t>& deps,
                                          size_t relu_index);
 
+                /**
+                 * Relu backprop writing the masked delta of op::ConvolutionBiasBackprop into a
+                 * workspace, whose index is stored in deps[3]
+                 */
+                void build_convolution_bias_backprop_relu(
+                    std::vector<dnnl::memory*>& dnnl_memories,
+                    std::vector<dnnl::primitive*>& dnnl_primitives,
+                    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                    std::vector<char*>& dnnl_workspaces,
+                    const dnnl::eltwise_backward::desc& bwd_desc,
+                    const dnnl::eltwise_forward::desc& fwd_desc,
+                    std::vector<size_t>& deps,
+                    size_t relu_index);
+
                 void build_sigmoid_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                            std::vector<dnnl::primitive*>& dnnl_primitives,
                                            std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -32,6 +32,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -205,6 +206,13 @@ void runtime::cpu::dnnl_utils::assign_dnnl_kernel(Node* node)
 
 bool runtime::cpu::dnnl_utils::can_use_dnnl_batchnorm_fprop(const ngraph::Node* node)
 {
+    // DNNL computes batch statistics with a thread count dependent reduction order
+    if (executor::is_deterministic() && (is_type<ngraph::op::v0::BatchNormTraining>(node) ||
+                                         is_type<ngraph::op::BatchNormTrainingRelu>(node)))
+    {
+        return false;
+    }
+
     auto input_rank = node->get_input_shape(2).size();
     auto input_element_type = node->get_input_element_type(2);
 
@@ -241,6 +249,11 @@ dnnl::algorithm runtime::cpu::dnnl_utils::get_conv_algo()
 
 bool runtime::cpu::dnnl_utils::can_use_dnnl_batchnorm_bprop(const ngraph::Node* node)
 {
+    if (executor::is_deterministic())
+    {
+        return false;
+    }
+
     auto input_rank = node->get_input_shape(2).size();
     auto input_element_type = node->get_input_element_type(2);
     auto delta_rank = node->get_input_shape(5).size();
@@ -0,0 +1,277 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace broadcast_binary
+                {
+                    // Output dimensions and the element strides each input is read with.
+                    // Broadcast dimensions have stride 0.
+                    struct Layout
+                    {
+                        std::vector<size_t> shape;
+                        std::vector<size_t> strides0;
+                        std::vector<size_t> strides1;
+                    };
+
+                    inline std::vector<size_t> get_strides(const Shape& shape,
+                                                           const AxisSet& broadcast_axes)
+                    {
+                        std::vector<size_t> strides(shape.size(), 0);
+                        size_t stride = 1;
+                        for (size_t i = shape.size(); i-- > 0;)
+                        {
+                            if (broadcast_axes.count(i) == 0)
+                            {
+                                strides[i] = stride;
+                                stride *= shape[i];
+                            }
+                        }
+                        return strides;
+                    }
+
+                    // Unit dimensions are dropped and neighbouring dimensions that both inputs
+                    // read the same way are merged, so that the innermost dimension is as long
+                    // as possible.
+                    inline Layout make_layout(const Shape& shape,
+                                              const AxisSet& broadcast_axes0,
+                                              const AxisSet& broadcast_axes1)
+                    {
+                        auto strides0 = get_strides(shape, broadcast_axes0);
+                        auto strides1 = get_strides(shape, broadcast_axes1);
+                        Layout layout;
+                        for (size_t i = 0; i < shape.size(); i++)
+                        {
+                            if (shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            if (!layout.shape.empty() &&
+                                layout.strides0.back() == strides0[i] * shape[i] &&
+                                layout.strides1.back() == strides1[i] * shape[i])
+                            {
+                                layout.shape.back() *= shape[i];
+                                layout.strides0.back() = strides0[i];
+                                layout.strides1.back() = strides1[i];
+                                continue;
+                            }
+                            layout.shape.push_back(shape[i]);
+                            layout.strides0.push_back(strides0[i]);
+                            layout.strides1.push_back(strides1[i]);
+                        }
+                        if (layout.shape.empty())
+                        {
+                            layout.shape.push_back(1);
+                            layout.strides0.push_back(0);
+                            layout.strides1.push_back(0);
+                        }
+                        return layout;
+                    }
+
+                    template <typename ElementType, typename Op>
+                    void compute(void* input0,
+                                 void* input1,
+                                 void* output,
+                                 const Layout& layout,
+                                 Op op,
+                                 int arena)
+                    {
+                        auto in0 = static_cast<const ElementType*>(input0);
+                        auto in1 = static_cast<const ElementType*>(input1);
+                        auto out = static_cast<ElementType*>(output);
+
+                        const size_t rank = layout.shape.size();
+                        const size_t inner = layout.shape.back();
+                        const bool contiguous0 = layout.strides0.back() != 0;
+                        const bool contiguous1 = layout.strides1.back() != 0;
+                        size_t rows = 1;
+                        for (size_t i = 0; i + 1 < rank; i++)
+                        {
+                            rows *= layout.shape[i];
+                        }
+
+                        auto& device =
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                        device.parallelFor(
+                            rows,
+                            Eigen::TensorOpCost(2 * inner * sizeof(ElementType),
+                                                inner * sizeof(ElementType),
+                                                inner),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index row = first; row < last; row++)
+                                {
+                                    size_t offset0 = 0;
+                                    size_t offset1 = 0;
+                                    size_t index = row;
+                                    for (size_t i = rank - 1; i-- > 0;)
+                                    {
+                                        size_t coordinate = index % layout.shape[i];
+                                        index /= layout.shape[i];
+                                        offset0 += coordinate * layout.strides0[i];
+                                        offset1 += coordinate * layout.strides1[i];
+                                    }
+                                    const ElementType* a = in0 + offset0;
+                                    const ElementType* b = in1 + offset1;
+                                    ElementType* c = out + row * inner;
+                                    if (contiguous0 && contiguous1)
+                                    {
+                                        for (size_t j = 0; j < inner; j++)
+                                        {
+                                            c[j] = op(a[j], b[j]);
+                                        }
+                                    }
+                                    else if (contiguous0)
+                                    {
+                                        const ElementType scalar = *b;
+                                        for (size_t j = 0; j < inner; j++)
+                                        {
+                                            c[j] = op(a[j], scalar);
+                                        }
+                                    }
+                                    else if (contiguous1)
+                                    {
+                                        const ElementType scalar = *a;
+                                        for (size_t j = 0; j < inner; j++)
+                                        {
+                                            c[j] = op(scalar, b[j]);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        std::fill(c, c + inner, op(*a, *b));
+                                    }
+                                }
+                            });
+                    }
+                }
+
+                template <typename ElementType>
+                void broadcast_add(void* input0,
+                                   void* input1,
+                                   void* output,
+                                   const broadcast_binary::Layout& layout,
+                                   int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a + b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void broadcast_subtract(void* input0,
+                                        void* input1,
+                                        void* output,
+                                        const broadcast_binary::Layout& layout,
+                                        int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a - b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void broadcast_multiply(void* input0,
+                                        void* input1,
+                                        void* output,
+                                        const broadcast_binary::Layout& layout,
+                                        int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a * b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void broadcast_divide(void* input0,
+                                      void* input1,
+                                      void* output,
+                                      const broadcast_binary::Layout& layout,
+                                      int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a / b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void broadcast_maximum(void* input0,
+                                       void* input1,
+                                       void* output,
+                                       const broadcast_binary::Layout& layout,
+                                       int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a > b ? a : b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void broadcast_minimum(void* input0,
+                                       void* input1,
+                                       void* output,
+                                       const broadcast_binary::Layout& layout,
+                                       int arena)
+                {
+                    broadcast_binary::compute<ElementType>(
+                        input0,
+                        input1,
+                        output,
+                        layout,
+                        [](ElementType a, ElementType b) -> ElementType { return a < b ? a : b; },
+                        arena);
+                }
+            }
+        }
+    }
+}
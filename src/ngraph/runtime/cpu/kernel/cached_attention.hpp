@@ -0,0 +1,125 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/state/kv_cache_state.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Stages key and value in the cache, computes causal attention of every query
+                // position over the valid prefix plus the staged positions, and only then
+                // commits them. Only the leading positions of the capacity positions laid out
+                // per sequence are used; the remaining output rows are zeroed. Only the valid
+                // prefix is read, so the cost of a call grows with the cached length, not
+                // max_length. The whole step holds the cache lock since all execution contexts
+                // share the cache.
+                template <typename ElementType>
+                void cached_attention(const ElementType* query,
+                                      const ElementType* key,
+                                      const ElementType* value,
+                                      ElementType* out,
+                                      KVCacheState* cache,
+                                      size_t sequences,
+                                      size_t positions,
+                                      size_t capacity,
+                                      size_t key_dim,
+                                      size_t value_dim,
+                                      ElementType scale,
+                                      int arena)
+                {
+                    std::lock_guard<std::mutex> lock(cache->get_mutex());
+                    cache->stage(key, value, positions, capacity);
+                    const size_t length = cache->get_length() + positions;
+                    const size_t max_length = cache->get_max_length();
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        sequences * positions,
+                        Eigen::TensorOpCost(length * (key_dim + value_dim) * sizeof(ElementType),
+                                            value_dim * sizeof(ElementType),
+                                            length * (2 * key_dim + 2 * value_dim + 4)),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<ElementType> scores(max_length);
+                            for (Eigen::Index row = first; row < last; row++)
+                            {
+                                const size_t n = row / positions;
+                                const size_t t = row % positions;
+                                const size_t valid = length - positions + t + 1;
+                                const ElementType* q = query + (n * capacity + t) * key_dim;
+                                const ElementType* keys =
+                                    reinterpret_cast<const ElementType*>(cache->get_keys(n));
+                                const ElementType* values =
+                                    reinterpret_cast<const ElementType*>(cache->get_values(n));
+
+                                ElementType max_score = -INFINITY;
+                                for (size_t j = 0; j < valid; j++)
+                                {
+                                    ElementType s = 0;
+                                    for (size_t d = 0; d < key_dim; d++)
+                                    {
+                                        s += q[d] * keys[j * key_dim + d];
+                                    }
+                                    scores[j] = s * scale;
+                                    max_score = std::max(max_score, scores[j]);
+                                }
+                                ElementType sum = 0;
+                                for (size_t j = 0; j < valid; j++)
+                                {
+                                    scores[j] = std::exp(scores[j] - max_score);
+                                    sum += scores[j];
+                                }
+
+                                ElementType* o = out + (n * capacity + t) * value_dim;
+                                std::fill(o, o + value_dim, ElementType(0));
+                                for (size_t j = 0; j < valid; j++)
+                                {
+                                    const ElementType w = scores[j] / sum;
+                                    for (size_t d = 0; d < value_dim; d++)
+                                    {
+                                        o[d] += w * values[j * value_dim + d];
+                                    }
+                                }
+                            }
+                        });
+                    for (size_t n = 0; n < sequences; n++)
+                    {
+                        std::fill(out + (n * capacity + positions) * value_dim,
+                                  out + (n + 1) * capacity * value_dim,
+                                  ElementType(0));
+                    }
+                    cache->commit(positions);
+                }
+            }
+        }
+    }
+}
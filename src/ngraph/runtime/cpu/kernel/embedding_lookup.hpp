@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Copies one row of weights per index, with the rows split across threads. The
+                // kernel only moves bytes and is shared by all element types.
+                template <typename IndicesType>
+                void embedding_lookup(void* indices,
+                                      void* weights,
+                                      void* output,
+                                      size_t indices_count,
+                                      size_t row_bytes,
+                                      int arena)
+                {
+                    auto idx = static_cast<const IndicesType*>(indices);
+                    auto in = static_cast<const char*>(weights);
+                    auto out = static_cast<char*>(output);
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(indices_count,
+                                       Eigen::TensorOpCost(row_bytes, row_bytes, 1),
+                                       [&](Eigen::Index first, Eigen::Index last) {
+                                           for (Eigen::Index i = first; i < last; i++)
+                                           {
+                                               memcpy(out + i * row_bytes,
+                                                      in + row_bytes *
+                                                               static_cast<size_t>(idx[i]),
+                                                      row_bytes);
+                                           }
+                                       });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each index tuple in the innermost dimension of indices selects a contiguous
+                // slice of params, so slices are copied whole and the tuples are split across
+                // threads. The kernel only moves bytes and is shared by all element types.
+                template <typename IndicesType>
+                void gather_nd(void* params,
+                               void* indices,
+                               void* output,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               size_t element_size,
+                               int arena)
+                {
+                    const size_t slice_rank = indices_shape.back();
+                    if (slice_rank == 0)
+                    {
+                        return;
+                    }
+                    const size_t tuples = shape_size(indices_shape) / slice_rank;
+                    size_t slice_size = 1;
+                    for (size_t i = slice_rank; i < params_shape.size(); i++)
+                    {
+                        slice_size *= params_shape[i];
+                    }
+                    std::vector<size_t> strides(slice_rank);
+                    size_t stride = slice_size;
+                    for (size_t i = slice_rank; i-- > 0;)
+                    {
+                        strides[i] = stride;
+                        stride *= params_shape[i];
+                    }
+
+                    auto in = static_cast<const char*>(params);
+                    auto idx = static_cast<const IndicesType*>(indices);
+                    auto out = static_cast<char*>(output);
+                    const size_t slice_bytes = slice_size * element_size;
+
+                    // Indices are checked once here rather than by every thread
+                    std::vector<size_t> offsets(tuples);
+                    for (size_t t = 0; t < tuples; t++)
+                    {
+                        const IndicesType* tuple = idx + t * slice_rank;
+                        size_t offset = 0;
+                        for (size_t i = 0; i < slice_rank; i++)
+                        {
+                            const int64_t dim = static_cast<int64_t>(params_shape[i]);
+                            // take care of negative indices
+                            int64_t index = tuple[i] >= 0 ? tuple[i] : tuple[i] + dim;
+                            if (index < 0 || index >= dim)
+                            {
+                                throw ngraph_error("GatherND index " + std::to_string(tuple[i]) +
+                                                   " out of bounds for axis " +
+                                                   std::to_string(i) + " of size " +
+                                                   std::to_string(dim));
+                            }
+                            offset += static_cast<size_t>(index) * strides[i];
+                        }
+                        offsets[t] = offset * element_size;
+                    }
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        tuples,
+                        Eigen::TensorOpCost(slice_bytes, slice_bytes, 1),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index t = first; t < last; t++)
+                            {
+                                memcpy(out + t * slice_bytes, in + offsets[t], slice_bytes);
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
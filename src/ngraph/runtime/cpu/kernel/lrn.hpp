@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Same window and formula as reference::lrn. Elements are split across threads
+                // and each walks its window with precomputed strides instead of coordinate
+                // transforms.
+                template <typename ElementType>
+                void lrn(void* input,
+                         void* output,
+                         const Shape& input_shape,
+                         const AxisSet& axes,
+                         double dalpha,
+                         double dbeta,
+                         double dbias,
+                         size_t size,
+                         int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    const ElementType alpha = static_cast<ElementType>(dalpha);
+                    const ElementType beta = static_cast<ElementType>(dbeta);
+                    const ElementType bias = static_cast<ElementType>(dbias);
+                    const size_t rank = input_shape.size();
+                    const size_t half = (size - 1) / 2;
+
+                    std::vector<size_t> strides(rank);
+                    size_t stride = 1;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        strides[i] = stride;
+                        stride *= input_shape[i];
+                    }
+                    const size_t count = stride;
+                    const std::vector<size_t> axes_vec(axes.begin(), axes.end());
+                    const size_t k = axes_vec.size();
+                    size_t window = 1;
+                    for (auto axis : axes_vec)
+                    {
+                        window *= std::min(size, input_shape[axis]);
+                    }
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        count,
+                        Eigen::TensorOpCost(window * sizeof(ElementType),
+                                            sizeof(ElementType),
+                                            2 * window + 10),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<size_t> coord(rank);
+                            size_t index = first;
+                            for (size_t i = rank; i-- > 0;)
+                            {
+                                coord[i] = index % input_shape[i];
+                                index /= input_shape[i];
+                            }
+                            std::vector<size_t> begin(k), end(k), cur(k);
+                            for (Eigen::Index e = first; e < last; e++)
+                            {
+                                // Offset of the window corner, with the window axes at 0
+                                size_t base = e;
+                                for (size_t a = 0; a < k; a++)
+                                {
+                                    size_t axis = axes_vec[a];
+                                    size_t c = coord[axis];
+                                    begin[a] = c > half ? c - half : 0;
+                                    end[a] = std::min(input_shape[axis], c + half + 1);
+                                    base -= c * strides[axis];
+                                    cur[a] = begin[a];
+                                }
+
+                                ElementType square_sum = 0;
+                                bool done = false;
+                                while (!done)
+                                {
+                                    size_t offset = base;
+                                    for (size_t a = 0; a < k; a++)
+                                    {
+                                        offset += cur[a] * strides[axes_vec[a]];
+                                    }
+                                    square_sum += in[offset] * in[offset];
+                                    done = true;
+                                    for (size_t a = k; a-- > 0;)
+                                    {
+                                        if (++cur[a] < end[a])
+                                        {
+                                            done = false;
+                                            break;
+                                        }
+                                        cur[a] = begin[a];
+                                    }
+                                }
+
+                                out[e] = in[e] / std::pow(bias + (alpha / size) * square_sum, beta);
+
+                                for (size_t i = rank; i-- > 0;)
+                                {
+                                    if (++coord[i] < input_shape[i])
+                                    {
+                                        break;
+                                    }
+                                    coord[i] = 0;
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
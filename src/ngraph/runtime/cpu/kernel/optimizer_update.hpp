@@ -0,0 +1,235 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace optimizer
+                {
+                    // Elements per unit of parallel work. Tensors are cut into chunks of this
+                    // size so that all parameters of an update share one parallel region.
+                    static const size_t chunk_size = 16384;
+
+                    struct Chunk
+                    {
+                        size_t tensor;
+                        size_t begin;
+                        size_t end;
+                    };
+
+                    // Buffers of one parameter tensor. state1 is unused by SGD momentum.
+                    template <typename ElementType>
+                    struct Tensors
+                    {
+                        const ElementType* param;
+                        const ElementType* grad;
+                        const ElementType* state0;
+                        const ElementType* state1;
+                        ElementType* out_param;
+                        ElementType* out_state0;
+                        ElementType* out_state1;
+                    };
+
+                    inline std::vector<Chunk> make_chunks(const std::vector<size_t>& sizes)
+                    {
+                        std::vector<Chunk> chunks;
+                        for (size_t t = 0; t < sizes.size(); t++)
+                        {
+                            for (size_t begin = 0; begin < sizes[t]; begin += chunk_size)
+                            {
+                                size_t end = std::min(begin + chunk_size, sizes[t]);
+                                chunks.push_back({t, begin, end});
+                            }
+                        }
+                        return chunks;
+                    }
+
+                    template <typename Body>
+                    void for_each_chunk(const std::vector<Chunk>& chunks,
+                                        size_t bytes_per_element,
+                                        size_t ops_per_element,
+                                        int arena,
+                                        Body body)
+                    {
+                        auto& device =
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                        device.parallelFor(
+                            chunks.size(),
+                            Eigen::TensorOpCost(chunk_size * bytes_per_element,
+                                                chunk_size * bytes_per_element,
+                                                chunk_size * ops_per_element),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index c = first; c < last; c++)
+                                {
+                                    body(c, chunks[c]);
+                                }
+                            });
+                    }
+                }
+
+                template <typename ElementType>
+                void sgd_momentum_update(
+                    const std::vector<optimizer::Tensors<ElementType>>& tensors,
+                    const std::vector<optimizer::Chunk>& chunks,
+                    ElementType learning_rate,
+                    ElementType momentum,
+                    ElementType weight_decay,
+                    int arena)
+                {
+                    optimizer::for_each_chunk(
+                        chunks,
+                        5 * sizeof(ElementType),
+                        5,
+                        arena,
+                        [&](size_t, const optimizer::Chunk& chunk) {
+                            const auto& t = tensors[chunk.tensor];
+                            for (size_t i = chunk.begin; i < chunk.end; i++)
+                            {
+                                ElementType v =
+                                    momentum * t.state0[i] + t.grad[i] + weight_decay * t.param[i];
+                                t.out_state0[i] = v;
+                                t.out_param[i] = t.param[i] - learning_rate * v;
+                            }
+                        });
+                }
+
+                template <typename ElementType>
+                void adam_update(const std::vector<optimizer::Tensors<ElementType>>& tensors,
+                                 const std::vector<optimizer::Chunk>& chunks,
+                                 ElementType learning_rate,
+                                 ElementType beta1,
+                                 ElementType beta2,
+                                 ElementType epsilon,
+                                 ElementType weight_decay,
+                                 int arena)
+                {
+                    optimizer::for_each_chunk(
+                        chunks,
+                        7 * sizeof(ElementType),
+                        12,
+                        arena,
+                        [&](size_t, const optimizer::Chunk& chunk) {
+                            const auto& t = tensors[chunk.tensor];
+                            for (size_t i = chunk.begin; i < chunk.end; i++)
+                            {
+                                ElementType g = t.grad[i];
+                                ElementType m = beta1 * t.state0[i] + (1 - beta1) * g;
+                                ElementType v = beta2 * t.state1[i] + (1 - beta2) * g * g;
+                                t.out_state0[i] = m;
+                                t.out_state1[i] = v;
+                                t.out_param[i] =
+                                    t.param[i] - learning_rate * (m / (std::sqrt(v) + epsilon) +
+                                                                  weight_decay * t.param[i]);
+                            }
+                        });
+                }
+
+                // The trust ratio of each tensor needs the norms of the whole parameter and
+                // step, so the moments are written and the per-chunk partial norms collected in
+                // a first pass, and the parameters are updated in a second one. Partials are
+                // combined in chunk order, which keeps the result independent of scheduling.
+                template <typename ElementType>
+                void lamb_update(const std::vector<optimizer::Tensors<ElementType>>& tensors,
+                                 const std::vector<optimizer::Chunk>& chunks,
+                                 ElementType learning_rate,
+                                 ElementType beta1,
+                                 ElementType beta2,
+                                 ElementType epsilon,
+                                 ElementType weight_decay,
+                                 int arena)
+                {
+                    std::vector<ElementType> param_partials(chunks.size());
+                    std::vector<ElementType> step_partials(chunks.size());
+                    optimizer::for_each_chunk(
+                        chunks,
+                        6 * sizeof(ElementType),
+                        14,
+                        arena,
+                        [&](size_t c, const optimizer::Chunk& chunk) {
+                            const auto& t = tensors[chunk.tensor];
+                            ElementType param_norm = 0;
+                            ElementType step_norm = 0;
+                            for (size_t i = chunk.begin; i < chunk.end; i++)
+                            {
+                                ElementType g = t.grad[i];
+                                ElementType m = beta1 * t.state0[i] + (1 - beta1) * g;
+                                ElementType v = beta2 * t.state1[i] + (1 - beta2) * g * g;
+                                t.out_state0[i] = m;
+                                t.out_state1[i] = v;
+                                ElementType step =
+                                    m / (std::sqrt(v) + epsilon) + weight_decay * t.param[i];
+                                param_norm += t.param[i] * t.param[i];
+                                step_norm += step * step;
+                            }
+                            param_partials[c] = param_norm;
+                            step_partials[c] = step_norm;
+                        });
+
+                    std::vector<ElementType> rates(tensors.size(), 0);
+                    std::vector<ElementType> param_norms(tensors.size(), 0);
+                    std::vector<ElementType> step_norms(tensors.size(), 0);
+                    for (size_t c = 0; c < chunks.size(); c++)
+                    {
+                        param_norms[chunks[c].tensor] += param_partials[c];
+                        step_norms[chunks[c].tensor] += step_partials[c];
+                    }
+                    for (size_t t = 0; t < tensors.size(); t++)
+                    {
+                        ElementType trust = 1;
+                        if (param_norms[t] > 0 && step_norms[t] > 0)
+                        {
+                            trust = std::sqrt(param_norms[t]) / std::sqrt(step_norms[t]);
+                        }
+                        rates[t] = learning_rate * trust;
+                    }
+
+                    optimizer::for_each_chunk(
+                        chunks,
+                        4 * sizeof(ElementType),
+                        6,
+                        arena,
+                        [&](size_t, const optimizer::Chunk& chunk) {
+                            const auto& t = tensors[chunk.tensor];
+                            ElementType rate = rates[chunk.tensor];
+                            for (size_t i = chunk.begin; i < chunk.end; i++)
+                            {
+                                ElementType step =
+                                    t.out_state0[i] / (std::sqrt(t.out_state1[i]) + epsilon) +
+                                    weight_decay * t.param[i];
+                                t.out_param[i] = t.param[i] - rate * step;
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,293 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast_binary.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace quantization
+                {
+                    // Scale and zero point vary along the quantization axes only, so they are
+                    // read like the second input of a broadcast binary op whose broadcast axes
+                    // are all the other axes. strides0 of the layout belongs to the (dense)
+                    // input and output.
+                    inline broadcast_binary::Layout make_layout(const Shape& input_shape,
+                                                                const AxisSet& axes)
+                    {
+                        AxisSet broadcast_axes;
+                        for (size_t i = 0; i < input_shape.size(); i++)
+                        {
+                            if (axes.count(i) == 0)
+                            {
+                                broadcast_axes.insert(i);
+                            }
+                        }
+                        return broadcast_binary::make_layout(
+                            input_shape, AxisSet{}, broadcast_axes);
+                    }
+
+                    // Calls body(offset, szp_offset, szp_stride, count) for each innermost run
+                    // of the layout, with the runs split across the threads of the arena.
+                    template <typename Body>
+                    void for_each_run(const broadcast_binary::Layout& layout,
+                                      size_t bytes_per_element,
+                                      size_t ops_per_element,
+                                      int arena,
+                                      Body body)
+                    {
+                        const size_t rank = layout.shape.size();
+                        const size_t inner = layout.shape.back();
+                        const size_t szp_stride = layout.strides1.back();
+                        size_t rows = 1;
+                        for (size_t i = 0; i + 1 < rank; i++)
+                        {
+                            rows *= layout.shape[i];
+                        }
+
+                        auto& device =
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                        device.parallelFor(
+                            rows,
+                            Eigen::TensorOpCost(inner * bytes_per_element,
+                                                inner * bytes_per_element,
+                                                inner * ops_per_element),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index row = first; row < last; row++)
+                                {
+                                    size_t szp_offset = 0;
+                                    size_t index = row;
+                                    for (size_t i = rank - 1; i-- > 0;)
+                                    {
+                                        szp_offset +=
+                                            (index % layout.shape[i]) * layout.strides1[i];
+                                        index /= layout.shape[i];
+                                    }
+                                    body(row * inner, szp_offset, szp_stride, inner);
+                                }
+                            });
+                    }
+
+                    template <typename REAL, typename QUANT, typename Round>
+                    void quantize(const REAL* input,
+                                  const REAL* scale,
+                                  const QUANT* zero_point,
+                                  QUANT* output,
+                                  const broadcast_binary::Layout& layout,
+                                  Round round,
+                                  int arena)
+                    {
+                        const REAL lowest = static_cast<REAL>(std::numeric_limits<QUANT>::min());
+                        const REAL highest = static_cast<REAL>(std::numeric_limits<QUANT>::max());
+                        for_each_run(
+                            layout,
+                            sizeof(REAL) + sizeof(QUANT),
+                            6,
+                            arena,
+                            [&](size_t offset, size_t szp_offset, size_t szp_stride, size_t n) {
+                                const REAL* in = input + offset;
+                                const REAL* s = scale + szp_offset;
+                                const QUANT* zp = zero_point + szp_offset;
+                                QUANT* out = output + offset;
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    REAL qvalue = round(in[j] / s[j * szp_stride]);
+                                    qvalue += zp[j * szp_stride];
+                                    qvalue = std::max<REAL>(qvalue, lowest);
+                                    qvalue = std::min<REAL>(qvalue, highest);
+                                    out[j] = static_cast<QUANT>(qvalue);
+                                }
+                            });
+                    }
+                }
+
+                template <typename QUANT, typename REAL>
+                void dequantize(void* input,
+                                void* scale,
+                                void* zero_point,
+                                void* output,
+                                const broadcast_binary::Layout& layout,
+                                int arena)
+                {
+                    auto in = static_cast<const QUANT*>(input);
+                    auto s = static_cast<const REAL*>(scale);
+                    auto zp = static_cast<const QUANT*>(zero_point);
+                    auto out = static_cast<REAL*>(output);
+                    quantization::for_each_run(
+                        layout,
+                        sizeof(QUANT) + sizeof(REAL),
+                        2,
+                        arena,
+                        [&](size_t offset, size_t szp_offset, size_t szp_stride, size_t n) {
+                            if (szp_stride == 0)
+                            {
+                                const QUANT z = zp[szp_offset];
+                                const REAL m = s[szp_offset];
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    out[offset + j] = static_cast<REAL>(in[offset + j] - z) * m;
+                                }
+                            }
+                            else
+                            {
+                                for (size_t j = 0; j < n; j++)
+                                {
+                                    out[offset + j] =
+                                        static_cast<REAL>(in[offset + j] -
+                                                          zp[szp_offset + j * szp_stride]) *
+                                        s[szp_offset + j * szp_stride];
+                                }
+                            }
+                        });
+                }
+
+                // Rounding matches reference::quantize. The mode is resolved once per call so
+                // that the inner loop has no branches on it.
+                template <typename REAL, typename QUANT>
+                void quantize(void* input,
+                              void* scale,
+                              void* zero_point,
+                              void* output,
+                              const broadcast_binary::Layout& layout,
+                              ngraph::op::v0::Quantize::RoundMode round_mode,
+                              int arena)
+                {
+                    using RoundMode = ngraph::op::v0::Quantize::RoundMode;
+                    auto in = static_cast<const REAL*>(input);
+                    auto s = static_cast<const REAL*>(scale);
+                    auto zp = static_cast<const QUANT*>(zero_point);
+                    auto out = static_cast<QUANT*>(output);
+                    const REAL half = static_cast<REAL>(0.5);
+                    switch (round_mode)
+                    {
+                    case RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [half](REAL q) {
+                                                   REAL r = std::floor(std::fabs(q) + half);
+                                                   return q < 0 ? -r : r;
+                                               },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [half](REAL q) {
+                                                   REAL r = std::ceil(std::fabs(q) - half);
+                                                   return q < 0 ? -r : r;
+                                               },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_NEAREST_UPWARD:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [half](REAL q) { return std::floor(q + half); },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_NEAREST_DOWNWARD:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [half](REAL q) { return std::ceil(q - half); },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [half](REAL q) {
+                                                   REAL up = std::floor(q + half);
+                                                   REAL down = std::ceil(q - half);
+                                                   return std::fmod(up, 2.0) == 0.0 ? up : down;
+                                               },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_TOWARD_INFINITY:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [](REAL q) {
+                                                   REAL r = std::ceil(std::fabs(q));
+                                                   return q < 0 ? -r : r;
+                                               },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_TOWARD_ZERO:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [](REAL q) { return std::trunc(q); },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_UP:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [](REAL q) { return std::ceil(q); },
+                                               arena);
+                        break;
+                    case RoundMode::ROUND_DOWN:
+                        quantization::quantize(in,
+                                               s,
+                                               zp,
+                                               out,
+                                               layout,
+                                               [](REAL q) { return std::floor(q); },
+                                               arena);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,359 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Reductions used when NGRAPH_CPU_DETERMINISTIC is set. Every output element is
+                // folded over fixed size blocks in index order and the block results are then
+                // combined in a fixed binary tree, so the association order depends only on the
+                // input shape and never on the thread count or on scheduling. Threads only ever
+                // split independent outputs or independent blocks.
+                namespace deterministic
+                {
+                    constexpr size_t block_size = 1024;
+
+                    // Shapes and input strides of the kept axes (one slice per output) and of
+                    // the reduced axes (the elements of a slice). Offsets are computed from
+                    // these on the fly, so the plan stays O(rank) whatever the input size.
+                    struct ReductionPlan
+                    {
+                        ReductionPlan(const Shape& in_shape, const AxisSet& reduction_axes)
+                        {
+                            std::vector<size_t> strides = row_major_strides(in_shape);
+                            for (size_t axis = 0; axis < in_shape.size(); ++axis)
+                            {
+                                if (reduction_axes.count(axis))
+                                {
+                                    element_shape.push_back(in_shape[axis]);
+                                    element_strides.push_back(strides[axis]);
+                                }
+                                else
+                                {
+                                    slice_shape.push_back(in_shape[axis]);
+                                    slice_strides.push_back(strides[axis]);
+                                }
+                            }
+                            slices = shape_size(slice_shape);
+                            elements = shape_size(element_shape);
+                        }
+
+                        // Input offset of the first element of slice `index`
+                        size_t slice_offset(size_t index) const
+                        {
+                            size_t offset = 0;
+                            for (size_t axis = slice_shape.size(); axis-- > 0;)
+                            {
+                                offset += (index % slice_shape[axis]) * slice_strides[axis];
+                                index /= slice_shape[axis];
+                            }
+                            return offset;
+                        }
+
+                        Shape slice_shape;
+                        std::vector<size_t> slice_strides;
+                        Shape element_shape;
+                        std::vector<size_t> element_strides;
+                        size_t slices;
+                        size_t elements;
+                    };
+
+                    // Walks the elements of a slice in row-major order, keeping the offset
+                    // relative to the start of the slice
+                    class ElementCursor
+                    {
+                    public:
+                        ElementCursor(const ReductionPlan& plan, size_t index)
+                            : m_shape(plan.element_shape)
+                            , m_strides(plan.element_strides)
+                            , m_coordinate(m_shape.size())
+                            , m_offset(0)
+                        {
+                            for (size_t axis = m_shape.size(); axis-- > 0;)
+                            {
+                                m_coordinate[axis] = index % m_shape[axis];
+                                m_offset += m_coordinate[axis] * m_strides[axis];
+                                index /= m_shape[axis];
+                            }
+                        }
+
+                        size_t offset() const { return m_offset; }
+                        void next()
+                        {
+                            for (size_t axis = m_shape.size(); axis-- > 0;)
+                            {
+                                m_offset += m_strides[axis];
+                                if (++m_coordinate[axis] < m_shape[axis])
+                                {
+                                    return;
+                                }
+                                m_offset -= m_coordinate[axis] * m_strides[axis];
+                                m_coordinate[axis] = 0;
+                            }
+                        }
+
+                    private:
+                        const Shape& m_shape;
+                        const std::vector<size_t>& m_strides;
+                        std::vector<size_t> m_coordinate;
+                        size_t m_offset;
+                    };
+
+                    // Combines the per-block results in a binary tree whose shape only depends
+                    // on the number of blocks
+                    template <typename ElementType, typename Reducer>
+                    ElementType combine_blocks(const ElementType* partials,
+                                               size_t count,
+                                               Reducer reducer)
+                    {
+                        ElementType levels[64];
+                        size_t depth = 0;
+                        for (size_t block = 1; block <= count; ++block)
+                        {
+                            ElementType acc = partials[block - 1];
+                            for (size_t merged = block; (merged & 1) == 0; merged >>= 1)
+                            {
+                                acc = reducer(levels[--depth], acc);
+                            }
+                            levels[depth++] = acc;
+                        }
+                        ElementType result = levels[--depth];
+                        while (depth > 0)
+                        {
+                            result = reducer(levels[--depth], result);
+                        }
+                        return result;
+                    }
+
+                    template <typename ElementType, typename Reducer>
+                    ElementType reduce_block(const ElementType* base,
+                                             const ReductionPlan& plan,
+                                             size_t block,
+                                             Reducer reducer)
+                    {
+                        size_t begin = block * block_size;
+                        size_t end = std::min(begin + block_size, plan.elements);
+                        ElementCursor cursor(plan, begin);
+                        ElementType acc = base[cursor.offset()];
+                        for (size_t i = begin + 1; i < end; ++i)
+                        {
+                            cursor.next();
+                            acc = reducer(acc, base[cursor.offset()]);
+                        }
+                        return acc;
+                    }
+
+                    // out[s] = reduction of slice s of `in`, for every slice of `plan`
+                    template <typename ElementType, typename Reducer>
+                    void reduce(const ElementType* in,
+                                ElementType* out,
+                                const ReductionPlan& plan,
+                                ElementType identity,
+                                Reducer reducer,
+                                int arena)
+                    {
+                        auto& device =
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                        size_t slices = plan.slices;
+                        size_t elements = plan.elements;
+                        if (elements == 0)
+                        {
+                            std::fill(out, out + slices, identity);
+                            return;
+                        }
+                        size_t blocks = (elements + block_size - 1) / block_size;
+
+                        if (slices == 1 && blocks > 1)
+                        {
+                            // Too few outputs to keep the pool busy; split the blocks instead
+                            std::vector<ElementType> partials(blocks);
+                            device.parallelFor(
+                                blocks,
+                                Eigen::TensorOpCost(block_size * sizeof(ElementType),
+                                                    sizeof(ElementType),
+                                                    block_size),
+                                [&](Eigen::Index first, Eigen::Index last) {
+                                    for (Eigen::Index b = first; b < last; ++b)
+                                    {
+                                        partials[b] = reduce_block(in, plan, b, reducer);
+                                    }
+                                });
+                            out[0] = combine_blocks(partials.data(), blocks, reducer);
+                            return;
+                        }
+
+                        device.parallelFor(
+                            slices,
+                            Eigen::TensorOpCost(
+                                elements * sizeof(ElementType), sizeof(ElementType), elements),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                std::vector<ElementType> partials(blocks);
+                                for (Eigen::Index s = first; s < last; ++s)
+                                {
+                                    const ElementType* base = in + plan.slice_offset(s);
+                                    for (size_t b = 0; b < blocks; ++b)
+                                    {
+                                        partials[b] = reduce_block(base, plan, b, reducer);
+                                    }
+                                    out[s] = combine_blocks(partials.data(), blocks, reducer);
+                                }
+                            });
+                    }
+                }
+
+                template <typename ElementType>
+                void deterministic_sum(void* input,
+                                       void* output,
+                                       const deterministic::ReductionPlan& plan,
+                                       int arena)
+                {
+                    deterministic::reduce(static_cast<ElementType*>(input),
+                                          static_cast<ElementType*>(output),
+                                          plan,
+                                          ElementType(0),
+                                          [](ElementType a, ElementType b) { return a + b; },
+                                          arena);
+                }
+
+                template <typename ElementType>
+                void deterministic_product(void* input,
+                                           void* output,
+                                           const deterministic::ReductionPlan& plan,
+                                           int arena)
+                {
+                    deterministic::reduce(static_cast<ElementType*>(input),
+                                          static_cast<ElementType*>(output),
+                                          plan,
+                                          ElementType(1),
+                                          [](ElementType a, ElementType b) { return a * b; },
+                                          arena);
+                }
+
+                template <typename ElementType>
+                void deterministic_max(void* input,
+                                       void* output,
+                                       const deterministic::ReductionPlan& plan,
+                                       int arena)
+                {
+                    deterministic::reduce(
+                        static_cast<ElementType*>(input),
+                        static_cast<ElementType*>(output),
+                        plan,
+                        ElementType(std::numeric_limits<ElementType>::has_infinity
+                                        ? -std::numeric_limits<ElementType>::infinity()
+                                        : std::numeric_limits<ElementType>::lowest()),
+                        [](ElementType a, ElementType b) { return a > b ? a : b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void deterministic_min(void* input,
+                                       void* output,
+                                       const deterministic::ReductionPlan& plan,
+                                       int arena)
+                {
+                    deterministic::reduce(
+                        static_cast<ElementType*>(input),
+                        static_cast<ElementType*>(output),
+                        plan,
+                        ElementType(std::numeric_limits<ElementType>::has_infinity
+                                        ? std::numeric_limits<ElementType>::infinity()
+                                        : std::numeric_limits<ElementType>::max()),
+                        [](ElementType a, ElementType b) { return a < b ? a : b; },
+                        arena);
+                }
+
+                template <typename ElementType>
+                void deterministic_softmax(void* input,
+                                           void* output,
+                                           const deterministic::ReductionPlan& plan,
+                                           int arena)
+                {
+                    auto in = static_cast<ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    size_t slices = plan.slices;
+                    size_t elements = plan.elements;
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+
+                    std::vector<ElementType> slice_max(slices);
+                    deterministic::reduce(
+                        in,
+                        slice_max.data(),
+                        plan,
+                        ElementType(-std::numeric_limits<ElementType>::infinity()),
+                        [](ElementType a, ElementType b) { return a > b ? a : b; },
+                        arena);
+
+                    // Elementwise steps are order independent and may be split freely
+                    auto cost = Eigen::TensorOpCost(
+                        elements * sizeof(ElementType), elements * sizeof(ElementType), elements);
+                    device.parallelFor(slices, cost, [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index s = first; s < last; ++s)
+                        {
+                            size_t base = plan.slice_offset(s);
+                            deterministic::ElementCursor cursor(plan, 0);
+                            for (size_t e = 0; e < elements; ++e, cursor.next())
+                            {
+                                size_t i = base + cursor.offset();
+                                out[i] = std::exp(in[i] - slice_max[s]);
+                            }
+                        }
+                    });
+
+                    std::vector<ElementType> slice_sum(slices);
+                    deterministic::reduce(out,
+                                          slice_sum.data(),
+                                          plan,
+                                          ElementType(0),
+                                          [](ElementType a, ElementType b) { return a + b; },
+                                          arena);
+
+                    device.parallelFor(slices, cost, [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index s = first; s < last; ++s)
+                        {
+                            size_t base = plan.slice_offset(s);
+                            deterministic::ElementCursor cursor(plan, 0);
+                            for (size_t e = 0; e < elements; ++e, cursor.next())
+                            {
+                                out[base + cursor.offset()] /= slice_sum[s];
+                            }
+                        }
+                    });
+                }
+            }
+        }
+    }
+}
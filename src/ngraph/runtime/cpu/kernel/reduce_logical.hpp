@@ -0,0 +1,234 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace reduce_logical
+                {
+                    // Input dimensions split into the ones kept in the output and the reduced
+                    // ones, each with the strides they are read with. Unit dimensions are
+                    // dropped and neighbouring dimensions of the same kind are merged.
+                    struct Layout
+                    {
+                        std::vector<size_t> kept_shape;
+                        std::vector<size_t> kept_strides;
+                        std::vector<size_t> reduced_shape;
+                        std::vector<size_t> reduced_strides;
+                    };
+
+                    inline Layout make_layout(const Shape& shape, const AxisSet& reduction_axes)
+                    {
+                        Layout layout;
+                        size_t stride = 1;
+                        int last = -1;
+                        for (size_t i = shape.size(); i-- > 0;)
+                        {
+                            if (shape[i] != 1)
+                            {
+                                int reduced = reduction_axes.count(i) ? 1 : 0;
+                                auto& dims = reduced ? layout.reduced_shape : layout.kept_shape;
+                                auto& strides =
+                                    reduced ? layout.reduced_strides : layout.kept_strides;
+                                if (reduced == last)
+                                {
+                                    dims.back() *= shape[i];
+                                }
+                                else
+                                {
+                                    dims.push_back(shape[i]);
+                                    strides.push_back(stride);
+                                }
+                                last = reduced;
+                            }
+                            stride *= shape[i];
+                        }
+                        // Dimensions were collected innermost first
+                        std::reverse(layout.kept_shape.begin(), layout.kept_shape.end());
+                        std::reverse(layout.kept_strides.begin(), layout.kept_strides.end());
+                        std::reverse(layout.reduced_shape.begin(), layout.reduced_shape.end());
+                        std::reverse(layout.reduced_strides.begin(),
+                                     layout.reduced_strides.end());
+                        return layout;
+                    }
+
+                    inline size_t get_offset(size_t index,
+                                             const std::vector<size_t>& shape,
+                                             const std::vector<size_t>& strides)
+                    {
+                        size_t offset = 0;
+                        for (size_t i = shape.size(); i-- > 0;)
+                        {
+                            offset += (index % shape[i]) * strides[i];
+                            index /= shape[i];
+                        }
+                        return offset;
+                    }
+
+                    // Scans count reduced elements starting at the reduced index begin and
+                    // returns early once an element equal to stop_value is seen.
+                    inline bool scan(const char* in,
+                                     const Layout& layout,
+                                     size_t begin,
+                                     size_t count,
+                                     bool stop_value)
+                    {
+                        if (layout.reduced_shape.empty())
+                        {
+                            return count > 0 && (in[0] != 0) == stop_value;
+                        }
+                        const size_t inner = layout.reduced_shape.back();
+                        const size_t inner_stride = layout.reduced_strides.back();
+                        size_t index = begin;
+                        const size_t end = begin + count;
+                        while (index < end)
+                        {
+                            const size_t j0 = index % inner;
+                            const size_t n = std::min(inner - j0, end - index);
+                            const char* p = in +
+                                            get_offset(index - j0,
+                                                       layout.reduced_shape,
+                                                       layout.reduced_strides) +
+                                            j0 * inner_stride;
+                            for (size_t j = 0; j < n; j++)
+                            {
+                                if ((p[j * inner_stride] != 0) == stop_value)
+                                {
+                                    return true;
+                                }
+                            }
+                            index += n;
+                        }
+                        return false;
+                    }
+
+                    // Any stops at the first true element and All at the first false one.
+                    // Outputs are split across threads, and when there are fewer outputs than
+                    // that the reduction of each output is split into chunks as well.
+                    inline void reduce(void* input,
+                                       void* output,
+                                       const Shape& input_shape,
+                                       const AxisSet& reduction_axes,
+                                       bool stop_value,
+                                       int arena)
+                    {
+                        static const size_t chunk_size = 16384;
+
+                        auto in = static_cast<const char*>(input);
+                        auto out = static_cast<char*>(output);
+                        const auto layout = make_layout(input_shape, reduction_axes);
+                        size_t outputs = 1;
+                        for (auto d : layout.kept_shape)
+                        {
+                            outputs *= d;
+                        }
+                        size_t reduced = 1;
+                        for (auto d : layout.reduced_shape)
+                        {
+                            reduced *= d;
+                        }
+
+                        auto& device =
+                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                        const size_t chunks =
+                            outputs >= chunk_size ? 1 : (reduced + chunk_size - 1) / chunk_size;
+                        if (chunks <= 1)
+                        {
+                            device.parallelFor(
+                                outputs,
+                                Eigen::TensorOpCost(reduced, 1, reduced),
+                                [&](Eigen::Index first, Eigen::Index last) {
+                                    for (Eigen::Index o = first; o < last; o++)
+                                    {
+                                        const char* base = in +
+                                                           get_offset(o,
+                                                                      layout.kept_shape,
+                                                                      layout.kept_strides);
+                                        bool found = scan(base, layout, 0, reduced, stop_value);
+                                        out[o] = found == stop_value;
+                                    }
+                                });
+                            return;
+                        }
+
+                        std::vector<char> found(outputs * chunks, 0);
+                        device.parallelFor(
+                            outputs * chunks,
+                            Eigen::TensorOpCost(chunk_size, 0, chunk_size),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                for (Eigen::Index w = first; w < last; w++)
+                                {
+                                    const size_t o = w / chunks;
+                                    const size_t begin = (w % chunks) * chunk_size;
+                                    const size_t count = std::min(chunk_size, reduced - begin);
+                                    const char* base = in +
+                                                       get_offset(o,
+                                                                  layout.kept_shape,
+                                                                  layout.kept_strides);
+                                    found[w] = scan(base, layout, begin, count, stop_value);
+                                }
+                            });
+                        for (size_t o = 0; o < outputs; o++)
+                        {
+                            bool any_found = false;
+                            for (size_t c = 0; c < chunks; c++)
+                            {
+                                any_found = any_found || found[o * chunks + c];
+                            }
+                            out[o] = any_found == stop_value;
+                        }
+                    }
+                }
+
+                inline void reduce_any(void* input,
+                                       void* output,
+                                       const Shape& input_shape,
+                                       const AxisSet& reduction_axes,
+                                       int arena)
+                {
+                    reduce_logical::reduce(input, output, input_shape, reduction_axes, true, arena);
+                }
+
+                inline void reduce_all(void* input,
+                                       void* output,
+                                       const Shape& input_shape,
+                                       const AxisSet& reduction_axes,
+                                       int arena)
+                {
+                    reduce_logical::reduce(
+                        input, output, input_shape, reduction_axes, false, arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Indices may repeat, so threads are not given whole update slices. Instead each
+                // thread owns a range of positions within a slice and applies every update to
+                // that range in order, which keeps the result identical to the reference.
+                template <typename ElementType, typename IndicesType>
+                void scatter_nd_add(void* inputs,
+                                    void* indices,
+                                    void* updates,
+                                    void* output,
+                                    const Shape& inputs_shape,
+                                    const Shape& indices_shape,
+                                    int arena)
+                {
+                    auto in = static_cast<const ElementType*>(inputs);
+                    auto idx = static_cast<const IndicesType*>(indices);
+                    auto up = static_cast<const ElementType*>(updates);
+                    auto out = static_cast<ElementType*>(output);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+
+                    // copy if not in place.
+                    if (inputs != output)
+                    {
+                        const size_t count = shape_size(inputs_shape);
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> dst(
+                            out, count);
+                        Eigen::TensorMap<Eigen::Tensor<const ElementType, 1, Eigen::RowMajor>>
+                            src(in, count);
+                        dst.device(device) = src;
+                    }
+
+                    const size_t slice_rank = indices_shape.back();
+                    if (slice_rank == 0)
+                    {
+                        return;
+                    }
+                    const size_t tuples = shape_size(indices_shape) / slice_rank;
+                    size_t slice_size = 1;
+                    for (size_t i = slice_rank; i < inputs_shape.size(); i++)
+                    {
+                        slice_size *= inputs_shape[i];
+                    }
+                    // Indices are checked here, before any thread writes to the output
+                    std::vector<size_t> offsets(tuples);
+                    for (size_t t = 0; t < tuples; t++)
+                    {
+                        size_t offset = 0;
+                        for (size_t i = 0; i < slice_rank; i++)
+                        {
+                            IndicesType index = idx[t * slice_rank + i];
+                            if (index < 0 || static_cast<size_t>(index) >= inputs_shape[i])
+                            {
+                                throw ngraph_error("ScatterNDAdd index " + std::to_string(index) +
+                                                   " out of bounds for axis " +
+                                                   std::to_string(i) + " of size " +
+                                                   std::to_string(inputs_shape[i]));
+                            }
+                            offset = offset * inputs_shape[i] + static_cast<size_t>(index);
+                        }
+                        offsets[t] = offset * slice_size;
+                    }
+
+                    device.parallelFor(
+                        slice_size,
+                        Eigen::TensorOpCost(2 * tuples * sizeof(ElementType),
+                                            tuples * sizeof(ElementType),
+                                            tuples),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (size_t t = 0; t < tuples; t++)
+                            {
+                                ElementType* dst = out + offsets[t];
+                                const ElementType* src = up + t * slice_size;
+                                for (Eigen::Index j = first; j < last; j++)
+                                {
+                                    dst[j] += src[j];
+                                }
+                            }
+                        });
+                }
+
+                template <typename ElementType>
+                void scatter_nd_add_i32(void* inputs,
+                                        void* indices,
+                                        void* updates,
+                                        void* output,
+                                        const Shape& inputs_shape,
+                                        const Shape& indices_shape,
+                                        int arena)
+                {
+                    scatter_nd_add<ElementType, int32_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
+                }
+
+                template <typename ElementType>
+                void scatter_nd_add_i64(void* inputs,
+                                        void* indices,
+                                        void* updates,
+                                        void* output,
+                                        const Shape& inputs_shape,
+                                        const Shape& indices_shape,
+                                        int arena)
+                {
+                    scatter_nd_add<ElementType, int64_t>(
+                        inputs, indices, updates, output, inputs_shape, indices_shape, arena);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
+
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::BroadcastBinary::type_info;
+
+op::BroadcastBinary::BroadcastBinary(const Output<Node>& arg0,
+                                     const Output<Node>& arg1,
+                                     Kind kind,
+                                     const Shape& shape,
+                                     const AxisSet& broadcast_axes0,
+                                     const AxisSet& broadcast_axes1)
+    : Op({arg0, arg1})
+    , m_kind(kind)
+    , m_shape(shape)
+    , m_broadcast_axes0(broadcast_axes0)
+    , m_broadcast_axes1(broadcast_axes1)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::BroadcastBinary::validate_and_infer_types()
+{
+    const auto& et = get_input_element_type(0);
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == et,
+                          "Arguments must have the same element type, got ",
+                          et,
+                          " and ",
+                          get_input_element_type(1),
+                          ".");
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        const auto& axes = i == 0 ? m_broadcast_axes0 : m_broadcast_axes1;
+        const auto& arg_shape = get_input_shape(i);
+
+        NODE_VALIDATION_CHECK(this,
+                              arg_shape.size() + axes.size() == m_shape.size() &&
+                                  (axes.empty() || *axes.rbegin() < m_shape.size()),
+                              "Argument ",
+                              i,
+                              " of shape ",
+                              arg_shape,
+                              " can't be broadcast to ",
+                              m_shape,
+                              " along axes ",
+                              axes,
+                              ".");
+
+        size_t arg_axis = 0;
+        for (size_t axis = 0; axis < m_shape.size(); axis++)
+        {
+            if (axes.count(axis) == 0)
+            {
+                NODE_VALIDATION_CHECK(this,
+                                      arg_shape.at(arg_axis++) == m_shape[axis],
+                                      "Argument ",
+                                      i,
+                                      " of shape ",
+                                      arg_shape,
+                                      " can't be broadcast to ",
+                                      m_shape,
+                                      " along axes ",
+                                      axes,
+                                      ".");
+            }
+        }
+    }
+
+    set_output_type(0, et, m_shape);
+}
+
+shared_ptr<Node> op::BroadcastBinary::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<BroadcastBinary>(
+        new_args.at(0), new_args.at(1), m_kind, m_shape, m_broadcast_axes0, m_broadcast_axes1);
+}
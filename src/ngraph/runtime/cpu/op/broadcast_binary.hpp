@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Binary elementwise op that broadcasts its inputs while reading them.
+        ///
+        /// Each input is interpreted as op::v0::Broadcast(arg, shape, broadcast_axes) would
+        /// produce it, without materializing the broadcast tensor. An empty axis set means
+        /// the input already has the output shape.
+        class BroadcastBinary : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"BroadcastBinary", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Kind
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum
+            };
+            CPU_BACKEND_API BroadcastBinary(const Output<Node>& arg0,
+                                            const Output<Node>& arg1,
+                                            Kind kind,
+                                            const Shape& shape,
+                                            const AxisSet& broadcast_axes0,
+                                            const AxisSet& broadcast_axes1);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            Kind get_kind() const { return m_kind; }
+            const Shape& get_broadcast_shape() const { return m_shape; }
+            const AxisSet& get_broadcast_axes0() const { return m_broadcast_axes0; }
+            const AxisSet& get_broadcast_axes1() const { return m_broadcast_axes1; }
+
+        private:
+            Kind m_kind;
+            Shape m_shape;
+            AxisSet m_broadcast_axes0;
+            AxisSet m_broadcast_axes1;
+        };
+    }
+}
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/cached_attention.hpp"
+
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::CachedAttention::type_info;
+
+op::CachedAttention::CachedAttention(const Output<Node>& query,
+                                     const Output<Node>& key,
+                                     const Output<Node>& value,
+                                     size_t max_length,
+                                     float scale)
+    : Op({query, key, value})
+    , m_max_length(max_length)
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::CachedAttention::CachedAttention(const Output<Node>& query,
+                                     const Output<Node>& key,
+                                     const Output<Node>& value,
+                                     const Output<Node>& positions,
+                                     size_t max_length,
+                                     float scale)
+    : Op({query, key, value, positions})
+    , m_max_length(max_length)
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::CachedAttention::validate_and_infer_types()
+{
+    const auto& et = get_input_element_type(0);
+    const auto& query_shape = get_input_shape(0);
+    const auto& key_shape = get_input_shape(1);
+    const auto& value_shape = get_input_shape(2);
+
+    NODE_VALIDATION_CHECK(this,
+                          et.is_real() && get_input_element_type(1) == et &&
+                              get_input_element_type(2) == et,
+                          "Query, key and value must share a floating point element type.");
+
+    NODE_VALIDATION_CHECK(this,
+                          query_shape.size() == 3 && key_shape.size() == 3 &&
+                              value_shape.size() == 3,
+                          "Query, key and value must have rank 3, got ",
+                          query_shape,
+                          ", ",
+                          key_shape,
+                          " and ",
+                          value_shape,
+                          ".");
+
+    NODE_VALIDATION_CHECK(this,
+                          query_shape == key_shape && value_shape[0] == query_shape[0] &&
+                              value_shape[1] == query_shape[1],
+                          "Key must match the query shape and value its first two dimensions, got ",
+                          query_shape,
+                          ", ",
+                          key_shape,
+                          " and ",
+                          value_shape,
+                          ".");
+
+    NODE_VALIDATION_CHECK(this,
+                          query_shape[1] <= m_max_length,
+                          "Positions per call (",
+                          query_shape[1],
+                          ") exceed the maximum cache length (",
+                          m_max_length,
+                          ").");
+
+    if (has_positions())
+    {
+        const auto& positions_type = get_input_element_type(3);
+        NODE_VALIDATION_CHECK(this,
+                              (positions_type == element::i32 || positions_type == element::i64) &&
+                                  get_input_shape(3) == Shape{},
+                              "Positions must be an i32 or i64 scalar, got ",
+                              positions_type,
+                              " ",
+                              get_input_shape(3),
+                              ".");
+    }
+
+    set_output_type(0, et, Shape{query_shape[0], query_shape[1], value_shape[2]});
+}
+
+shared_ptr<Node> op::CachedAttention::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    if (has_positions())
+    {
+        return make_shared<CachedAttention>(new_args.at(0),
+                                            new_args.at(1),
+                                            new_args.at(2),
+                                            new_args.at(3),
+                                            m_max_length,
+                                            m_scale);
+    }
+    return make_shared<CachedAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_max_length, m_scale);
+}
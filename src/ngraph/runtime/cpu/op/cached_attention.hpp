@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Scaled dot-product attention over a key/value cache owned by the executable.
+        ///
+        /// Inputs are query [N, T, Dk], key [N, T, Dk] and value [N, T, Dv], where N counts
+        /// sequences (batch times heads) and T the positions processed by this call. Each call
+        /// appends key and value to the cache in place, then every query position attends
+        /// causally over the valid prefix of the cache up to and including itself:
+        ///
+        ///   out[n, t] = softmax(scale * q[n, t] . K[n, :L - T + t + 1]) . V[n, :L - T + t + 1]
+        ///
+        /// where L is the cache length after the append. The output is [N, T, Dv]. The cache
+        /// holds at most max_length positions and is cleared by Executable::reset_state.
+        /// It is shared by all execution contexts, which take turns appending to it.
+        ///
+        /// Since shapes are fixed at compile time, an optional scalar integer input gives the
+        /// number of leading positions P <= T used by a call. The same executable can then
+        /// prefill a prompt and decode one position at a time, with T the largest step; the
+        /// output rows past P are zero.
+        class CachedAttention : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"CachedAttention", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API CachedAttention(const Output<Node>& query,
+                                            const Output<Node>& key,
+                                            const Output<Node>& value,
+                                            size_t max_length,
+                                            float scale);
+            CPU_BACKEND_API CachedAttention(const Output<Node>& query,
+                                            const Output<Node>& key,
+                                            const Output<Node>& value,
+                                            const Output<Node>& positions,
+                                            size_t max_length,
+                                            float scale);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            bool has_state() const override { return true; }
+            size_t get_max_length() const { return m_max_length; }
+            bool has_positions() const { return get_input_size() == 4; }
+            float get_scale() const { return m_scale; }
+
+        private:
+            size_t m_max_length;
+            float m_scale;
+        };
+    }
+}
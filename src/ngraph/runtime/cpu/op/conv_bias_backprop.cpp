@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
+#include "ngraph/validation_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ConvolutionBiasBackprop::type_info;
+
+op::ConvolutionBiasBackprop::ConvolutionBiasBackprop(const Output<Node>& data_batch,
+                                                     const Output<Node>& filters,
+                                                     const Output<Node>& output_delta,
+                                                     const Strides& window_movement_strides_forward,
+                                                     const Strides& window_dilation_strides_forward,
+                                                     const CoordinateDiff& padding_below_forward,
+                                                     const CoordinateDiff& padding_above_forward,
+                                                     const Strides& data_dilation_strides_forward)
+    : Op({data_batch, filters, output_delta})
+    , m_window_movement_strides_forward(window_movement_strides_forward)
+    , m_window_dilation_strides_forward(window_dilation_strides_forward)
+    , m_padding_below_forward(padding_below_forward)
+    , m_padding_above_forward(padding_above_forward)
+    , m_data_dilation_strides_forward(data_dilation_strides_forward)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::ConvolutionBiasBackprop::ConvolutionBiasBackprop(const Output<Node>& data_batch,
+                                                     const Output<Node>& filters,
+                                                     const Output<Node>& output_delta,
+                                                     const Output<Node>& relu_input,
+                                                     const Strides& window_movement_strides_forward,
+                                                     const Strides& window_dilation_strides_forward,
+                                                     const CoordinateDiff& padding_below_forward,
+                                                     const CoordinateDiff& padding_above_forward,
+                                                     const Strides& data_dilation_strides_forward)
+    : Op({data_batch, filters, output_delta, relu_input})
+    , m_window_movement_strides_forward(window_movement_strides_forward)
+    , m_window_dilation_strides_forward(window_dilation_strides_forward)
+    , m_padding_below_forward(padding_below_forward)
+    , m_padding_above_forward(padding_above_forward)
+    , m_data_dilation_strides_forward(data_dilation_strides_forward)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ConvolutionBiasBackprop::validate_and_infer_types()
+{
+    auto& data_batch_shape = get_input_shape(0);
+    auto& filters_shape = get_input_shape(1);
+    auto& delta_shape = get_input_shape(2);
+    element::Type et = get_input_element_type(0);
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == et && get_input_element_type(2) == et,
+                          "Element types of data batch, filters and delta do not match");
+
+    // The delta must be what the forward convolution would have produced
+    auto forward_shape = infer_convolution_forward(this,
+                                                   data_batch_shape,
+                                                   m_data_dilation_strides_forward,
+                                                   m_padding_below_forward,
+                                                   m_padding_above_forward,
+                                                   filters_shape,
+                                                   m_window_movement_strides_forward,
+                                                   m_window_dilation_strides_forward);
+    NODE_VALIDATION_CHECK(this,
+                          forward_shape.compatible(delta_shape),
+                          "Delta shape ",
+                          delta_shape,
+                          " does not match the forward convolution output shape ",
+                          forward_shape);
+
+    if (with_relu())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(3) == et &&
+                                  get_input_shape(3) == delta_shape,
+                              "Relu input must match the delta shape and element type");
+    }
+
+    set_output_size(3);
+    set_output_type(0, et, data_batch_shape);
+    set_output_type(1, et, filters_shape);
+    set_output_type(2, et, Shape{filters_shape.at(0)});
+}
+
+shared_ptr<Node>
+    op::ConvolutionBiasBackprop::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    if (new_args.size() == 4)
+    {
+        return make_shared<ConvolutionBiasBackprop>(new_args.at(0),
+                                                    new_args.at(1),
+                                                    new_args.at(2),
+                                                    new_args.at(3),
+                                                    m_window_movement_strides_forward,
+                                                    m_window_dilation_strides_forward,
+                                                    m_padding_below_forward,
+                                                    m_padding_above_forward,
+                                                    m_data_dilation_strides_forward);
+    }
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<ConvolutionBiasBackprop>(new_args.at(0),
+                                                new_args.at(1),
+                                                new_args.at(2),
+                                                m_window_movement_strides_forward,
+                                                m_window_dilation_strides_forward,
+                                                m_padding_below_forward,
+                                                m_padding_above_forward,
+                                                m_data_dilation_strides_forward);
+}
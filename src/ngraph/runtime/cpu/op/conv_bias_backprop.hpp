@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Data, filters and bias backprop of a convolution computed from one delta.
+        ///
+        /// Inputs are the forward data batch, the filters and the output delta. An optional
+        /// fourth input is the forward argument of a ReluBackprop producing the delta; the
+        /// delta is then zeroed where that argument is not positive before the gradients are
+        /// computed. Outputs are the data batch, filters and bias deltas.
+        class ConvolutionBiasBackprop : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"ConvolutionBiasBackprop", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API ConvolutionBiasBackprop(const Output<Node>& data_batch,
+                                                    const Output<Node>& filters,
+                                                    const Output<Node>& output_delta,
+                                                    const Strides& window_movement_strides_forward,
+                                                    const Strides& window_dilation_strides_forward,
+                                                    const CoordinateDiff& padding_below_forward,
+                                                    const CoordinateDiff& padding_above_forward,
+                                                    const Strides& data_dilation_strides_forward);
+
+            CPU_BACKEND_API ConvolutionBiasBackprop(const Output<Node>& data_batch,
+                                                    const Output<Node>& filters,
+                                                    const Output<Node>& output_delta,
+                                                    const Output<Node>& relu_input,
+                                                    const Strides& window_movement_strides_forward,
+                                                    const Strides& window_dilation_strides_forward,
+                                                    const CoordinateDiff& padding_below_forward,
+                                                    const CoordinateDiff& padding_above_forward,
+                                                    const Strides& data_dilation_strides_forward);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const Strides& get_window_movement_strides_forward() const
+            {
+                return m_window_movement_strides_forward;
+            }
+            const Strides& get_window_dilation_strides_forward() const
+            {
+                return m_window_dilation_strides_forward;
+            }
+            const CoordinateDiff& get_padding_below_forward() const
+            {
+                return m_padding_below_forward;
+            }
+            const CoordinateDiff& get_padding_above_forward() const
+            {
+                return m_padding_above_forward;
+            }
+            const Strides& get_data_dilation_strides_forward() const
+            {
+                return m_data_dilation_strides_forward;
+            }
+            /// \return true if the delta is masked by a Relu before backprop
+            bool with_relu() const { return get_input_size() == 4; }
+        protected:
+            Strides m_window_movement_strides_forward;
+            Strides m_window_dilation_strides_forward;
+            CoordinateDiff m_padding_below_forward;
+            CoordinateDiff m_padding_above_forward;
+            Strides m_data_dilation_strides_forward;
+        };
+    }
+}
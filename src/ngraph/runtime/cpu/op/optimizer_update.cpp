@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::OptimizerUpdate::type_info;
+
+op::OptimizerUpdate::OptimizerUpdate(const OutputVector& args,
+                                     Algorithm algorithm,
+                                     float learning_rate,
+                                     float beta1,
+                                     float beta2,
+                                     float epsilon,
+                                     float weight_decay)
+    : Op(args)
+    , m_algorithm(algorithm)
+    , m_learning_rate(learning_rate)
+    , m_beta1(beta1)
+    , m_beta2(beta2)
+    , m_epsilon(epsilon)
+    , m_weight_decay(weight_decay)
+{
+    constructor_validate_and_infer_types();
+}
+
+size_t op::OptimizerUpdate::get_state_count(Algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case Algorithm::SGDMomentum: return 1;
+    case Algorithm::Adam:
+    case Algorithm::Lamb: return 2;
+    }
+    throw ngraph_error("Unknown OptimizerUpdate algorithm");
+}
+
+void op::OptimizerUpdate::validate_and_infer_types()
+{
+    const size_t states = get_state_count(m_algorithm);
+    const size_t group_size = states + 2;
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() > 0 && get_input_size() % group_size == 0,
+                          "Expected ",
+                          group_size,
+                          " inputs per parameter tensor, got ",
+                          get_input_size(),
+                          " inputs.");
+
+    const size_t params = get_input_size() / group_size;
+    set_output_size(params * (states + 1));
+    for (size_t p = 0; p < params; p++)
+    {
+        const size_t first = p * group_size;
+        const auto& et = get_input_element_type(first);
+        const auto& shape = get_input_shape(first);
+
+        NODE_VALIDATION_CHECK(this,
+                              et.is_real(),
+                              "Parameter tensor ",
+                              p,
+                              " must have a floating point element type, got ",
+                              et,
+                              ".");
+
+        for (size_t i = first + 1; i < first + group_size; i++)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  get_input_element_type(i) == et &&
+                                      get_input_shape(i) == shape,
+                                  "Input ",
+                                  i,
+                                  " does not match the element type and shape of parameter ",
+                                  "tensor ",
+                                  p,
+                                  ".");
+        }
+
+        for (size_t o = 0; o < states + 1; o++)
+        {
+            set_output_type(p * (states + 1) + o, et, shape);
+        }
+    }
+}
+
+shared_ptr<Node> op::OptimizerUpdate::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    if (new_args.size() != get_input_size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<OptimizerUpdate>(new_args,
+                                        m_algorithm,
+                                        m_learning_rate,
+                                        m_beta1,
+                                        m_beta2,
+                                        m_epsilon,
+                                        m_weight_decay);
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Fused optimizer weight update over one or more parameter tensors.
+        ///
+        /// Inputs are laid out per parameter as (param, grad, state...), and outputs as
+        /// (param', state'...), where the number of state tensors depends on the algorithm:
+        ///
+        ///   SGDMomentum: state (v)
+        ///       v' = beta1 * v + grad + weight_decay * param
+        ///       param' = param - learning_rate * v'
+        ///   Adam: state (m, v); weight_decay is applied decoupled, as in AdamW
+        ///       m' = beta1 * m + (1 - beta1) * grad
+        ///       v' = beta2 * v + (1 - beta2) * grad * grad
+        ///       step = m' / (sqrt(v') + epsilon) + weight_decay * param
+        ///       param' = param - learning_rate * step
+        ///   Lamb: as Adam, with the step of each tensor scaled by |param| / |step|
+        ///
+        /// The Adam bias correction is expected to be folded into learning_rate by the caller.
+        class OptimizerUpdate : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"OptimizerUpdate", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class Algorithm
+            {
+                SGDMomentum,
+                Adam,
+                Lamb
+            };
+            CPU_BACKEND_API OptimizerUpdate(const OutputVector& args,
+                                            Algorithm algorithm,
+                                            float learning_rate,
+                                            float beta1,
+                                            float beta2 = 0.0f,
+                                            float epsilon = 0.0f,
+                                            float weight_decay = 0.0f);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            Algorithm get_algorithm() const { return m_algorithm; }
+            float get_learning_rate() const { return m_learning_rate; }
+            float get_beta1() const { return m_beta1; }
+            float get_beta2() const { return m_beta2; }
+            float get_epsilon() const { return m_epsilon; }
+            float get_weight_decay() const { return m_weight_decay; }
+            /// Number of state tensors kept per parameter by the algorithm
+            static CPU_BACKEND_API size_t get_state_count(Algorithm algorithm);
+            /// Number of parameter tensors updated by this node
+            size_t get_parameter_count() const
+            {
+                return get_input_size() / (get_state_count(m_algorithm) + 2);
+            }
+
+        private:
+            Algorithm m_algorithm;
+            float m_learning_rate;
+            float m_beta1;
+            float m_beta2;
+            float m_epsilon;
+            float m_weight_decay;
+        };
+    }
+}
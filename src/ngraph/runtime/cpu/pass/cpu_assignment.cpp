@@ -49,11 +49,13 @@
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
@@ -260,6 +262,26 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::ConvolutionBiasBackprop)
+                {
+                    (void)external_function;
+                    auto convolution = static_cast<ngraph::op::ConvolutionBiasBackprop*>(node);
+
+                    bool data_dilated = false;
+                    for (size_t s : convolution->get_data_dilation_strides_forward())
+                    {
+                        data_dilated = data_dilated || (s != 1);
+                    }
+
+                    // Only created by CPUConvBackpropFusion, which checks the same conditions
+                    if (!data_dilated && node->get_input_shape(0).size() == 4 &&
+                        node->get_input_element_type(0) == element::f32)
+                    {
+                        runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
+                    }
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::ConvolutionBackpropData)
                 {
@@ -687,7 +709,8 @@ namespace ngraph
 
                     if ((arg0_rank == 4 || arg0_rank == 2) &&
                         node->get_input_element_type(0) == element::f32 &&
-                        softmax->get_axes().size() == 1)
+                        softmax->get_axes().size() == 1 &&
+                        !runtime::cpu::executor::is_deterministic())
                     {
                         runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
                     }
@@ -1052,6 +1075,8 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::v0::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::pass::CPUAssignment::assign<
          ngraph::op::v0::ConvolutionBiasBackpropFiltersBias>},
+    {TI(ngraph::op::ConvolutionBiasBackprop),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBiasBackprop>},
     {TI(ngraph::op::v0::LRN), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::LRN>},
     {TI(ngraph::op::v0::Relu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Relu>},
     {TI(ngraph::op::v0::ReluBackprop),
@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_broadcast_folding.hpp"
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool get_kind(const shared_ptr<Node>& node, op::BroadcastBinary::Kind& kind)
+{
+    using Kind = op::BroadcastBinary::Kind;
+    if (is_type<op::v1::Add>(node))
+    {
+        kind = Kind::Add;
+    }
+    else if (is_type<op::v1::Subtract>(node))
+    {
+        kind = Kind::Subtract;
+    }
+    else if (is_type<op::v1::Multiply>(node))
+    {
+        kind = Kind::Multiply;
+    }
+    else if (is_type<op::v1::Divide>(node) && node->get_output_element_type(0).is_real())
+    {
+        // integer division has python semantics to honour
+        kind = Kind::Divide;
+    }
+    else if (is_type<op::v1::Maximum>(node))
+    {
+        kind = Kind::Maximum;
+    }
+    else if (is_type<op::v1::Minimum>(node))
+    {
+        kind = Kind::Minimum;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUBroadcastFolding::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    // Nodes computed from constants alone, which ConstantFolding evaluates later on
+    unordered_set<Node*> constant_nodes;
+    for (auto node : function->get_ordered_ops())
+    {
+        bool is_constant = is_type<op::v0::Constant>(node) || node->get_input_size() > 0;
+        for (auto& input : node->inputs())
+        {
+            is_constant =
+                is_constant && constant_nodes.count(input.get_source_output().get_node()) > 0;
+        }
+        if (is_constant)
+        {
+            // ConstantFolding has no evaluator for BroadcastBinary
+            constant_nodes.insert(node.get());
+            continue;
+        }
+
+        op::BroadcastBinary::Kind kind;
+        if (!get_kind(node, kind))
+        {
+            continue;
+        }
+
+        const auto& shape = node->get_output_shape(0);
+        if (node->get_input_shape(0) != shape || node->get_input_shape(1) != shape)
+        {
+            continue;
+        }
+
+        OutputVector args;
+        vector<AxisSet> broadcast_axes(2);
+        bool folded = false;
+        for (size_t i = 0; i < 2; i++)
+        {
+            auto arg = node->input_value(i);
+            if (auto broadcast = as_type_ptr<op::v0::Broadcast>(arg.get_node_shared_ptr()))
+            {
+                args.push_back(broadcast->input_value(0));
+                broadcast_axes[i] = broadcast->get_broadcast_axes();
+                folded = true;
+            }
+            else
+            {
+                args.push_back(arg);
+            }
+        }
+        if (!folded)
+        {
+            continue;
+        }
+
+        auto new_node = make_shared<op::BroadcastBinary>(
+            args.at(0), args.at(1), kind, shape, broadcast_axes.at(0), broadcast_axes.at(1));
+        NGRAPH_DEBUG << "Folding broadcasts of " << node->get_name() << " into "
+                     << new_node->get_name();
+        replace_node(node, new_node);
+        modified = true;
+    }
+    return modified;
+}
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPUBroadcastFolding;
+            }
+        }
+    }
+}
+
+/// \brief Folds explicit broadcasts into the binary elementwise ops that consume them.
+///
+/// ImplicitBroadcastElimination turns numpy style broadcasting into op::v0::Broadcast, which
+/// materializes a full size tensor before the elementwise op runs. Add, Subtract, Multiply,
+/// Divide, Maximum and Minimum reading a Broadcast are replaced with op::BroadcastBinary,
+/// which reads the smaller input with zero strides instead. Broadcasts left without users
+/// are removed with them. Ops computed from constants alone are left for ConstantFolding,
+/// which runs later and cannot evaluate op::BroadcastBinary.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUBroadcastFolding
+    : public ngraph::pass::FunctionPass
+{
+public:
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "ngraph/runtime/cpu/pass/cpu_constant_hoisting.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/experimental/compiled_kernel.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// A node can be precomputed if it is a constant, or if it is a stateless computation whose
+// inputs can all be precomputed
+static bool is_hoistable(const shared_ptr<Node>& node, const unordered_set<Node*>& hoistable)
+{
+    if (is_type<op::v0::Constant>(node))
+    {
+        return true;
+    }
+    // Compiled kernels carry their own subgraph and are left to their compiler
+    if (node->get_input_size() == 0 || node->is_parameter() || node->is_output() ||
+        node->has_state() || !node->get_control_dependencies().empty() ||
+        is_type<op::v0::CompiledKernel>(node))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node->get_output_size(); i++)
+    {
+        if (node->get_output_partial_shape(i).is_dynamic())
+        {
+            return false;
+        }
+    }
+    for (auto& input : node->inputs())
+    {
+        if (hoistable.count(input.get_source_output().get_node()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUConstantHoisting::run_on_function(shared_ptr<Function> function)
+{
+    unordered_set<Node*> hoistable;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (is_hoistable(node, hoistable))
+        {
+            hoistable.insert(node.get());
+        }
+    }
+
+    // Values computed from constants and consumed by the rest of the graph. Broadcasts are
+    // left alone since consumers read them cheaply and materializing them only costs memory.
+    OutputVector values;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (hoistable.count(node.get()) == 0 || is_type<op::v0::Constant>(node) ||
+            is_type<op::v0::Broadcast>(node))
+        {
+            continue;
+        }
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                if (hoistable.count(input.get_node()) == 0)
+                {
+                    values.push_back(output);
+                    break;
+                }
+            }
+        }
+    }
+    if (values.empty())
+    {
+        return false;
+    }
+
+    NodeMap node_map;
+    NodeVector roots;
+    for (auto& value : values)
+    {
+        roots.push_back(value.get_node_shared_ptr());
+    }
+    clone_nodes(roots, node_map);
+    ResultVector results;
+    for (auto& value : values)
+    {
+        results.push_back(make_shared<op::v0::Result>(
+            value.for_node(node_map.at(value.get_node()))));
+    }
+    auto precompute = make_shared<Function>(results, ParameterVector{});
+
+    // Evaluate with the same kernels as the function itself, without hoisting again
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_enable("CPUConstantHoisting", false);
+    CPU_Executable executable(precompute,
+                              pass_config,
+                              runtime::get_default_allocator(),
+                              false,
+                              EXECUTION_MODE::DIRECT_EXECUTION);
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (auto& value : values)
+    {
+        outputs.push_back(
+            make_shared<runtime::cpu::CPUTensor>(value.get_element_type(), value.get_shape()));
+    }
+    executable.call(outputs, {});
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        NGRAPH_DEBUG << "Precomputed " << values[i];
+        auto tensor = static_pointer_cast<runtime::cpu::CPUTensor>(outputs[i]);
+        auto constant = make_shared<op::v0::Constant>(
+            values[i].get_element_type(), values[i].get_shape(), tensor->get_data_ptr());
+        values[i].replace(constant->output(0));
+    }
+    return true;
+}
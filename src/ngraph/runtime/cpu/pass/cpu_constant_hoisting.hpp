@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPUConstantHoisting;
+            }
+        }
+    }
+}
+
+/// \brief Precomputes subgraphs that depend only on constants.
+///
+/// ConstantFolding only folds the ops it has transformations for, so subgraphs such as weight
+/// transposes feeding a Dot, weight quantization or Convert to bf16 otherwise run on every
+/// call. This pass gathers every parameter-independent value that is consumed by the rest of
+/// the graph, compiles them as one function on the CPU backend, runs it once and replaces the
+/// values with the resulting constants.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUConstantHoisting
+    : public ngraph::pass::FunctionPass
+{
+public:
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -72,6 +73,7 @@
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
@@ -80,12 +82,44 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/util.hpp"
 
+// Reads the value of a constant that holds the same f32 value in every element
+static bool get_uniform_constant(std::shared_ptr<ngraph::Node> node, float& value)
+{
+    auto constant = ngraph::as_type_ptr<ngraph::op::v0::Constant>(node);
+    if (!constant || constant->get_output_element_type(0) != ngraph::element::f32)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    if (values.empty())
+    {
+        return false;
+    }
+    for (auto v : values)
+    {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+        if (v != values[0])
+        {
+            return false;
+        }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+    }
+    value = values[0];
+    return true;
+}
+
 static bool init_cblas_arg(std::shared_ptr<ngraph::Node> reshape,
                            ngraph::Output<ngraph::Node> arg,
                            bool& transpose_w,
@@ -587,6 +621,127 @@ void ngraph::runtime::cpu::pass::CPUPreFusion::construct_maxpool_relu_switch()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::CPUConvBackpropFusion::construct_conv_bias_backprop()
+{
+    Shape shape{2, 2, 1, 1};
+    auto data_batch = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto delta = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto conv_bprop_filters =
+        std::make_shared<ngraph::op::v0::ConvolutionBackpropFilters>(data_batch,
+                                                                     shape,
+                                                                     delta,
+                                                                     Strides{1, 1},
+                                                                     Strides{1, 1},
+                                                                     CoordinateDiff{0, 0},
+                                                                     CoordinateDiff{0, 0},
+                                                                     Strides{1, 1});
+
+    auto callback = [data_batch, delta](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_conv_bias_backprop against node = "
+                     << m.get_match_root()->get_name();
+
+        auto pvm = m.get_pattern_value_map();
+        auto bprop_filters = m.get_match_root_as<ngraph::op::v0::ConvolutionBackpropFilters>();
+        NGRAPH_CHECK(bprop_filters,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `ngraph::op::v0::ConvolutionBackpropFilters`");
+
+        auto& data_shape = bprop_filters->get_input_shape(0);
+        if (data_shape.size() != 4 || bprop_filters->get_input_element_type(0) != element::f32)
+        {
+            return false;
+        }
+        for (size_t s : bprop_filters->get_data_dilation_strides_forward())
+        {
+            if (s != 1)
+            {
+                NGRAPH_DEBUG << "DNNL does not support data dilation in backprop";
+                return false;
+            }
+        }
+
+        // Look for the data gradient and the bias reduction computed from the same delta
+        auto delta_value = pvm[delta];
+        std::shared_ptr<ngraph::op::v0::ConvolutionBackpropData> bprop_data;
+        std::shared_ptr<ngraph::op::v0::Sum> bias_sum;
+        for (auto& target : delta_value.get_target_inputs())
+        {
+            auto user = target.get_node()->shared_from_this();
+            if (auto data = as_type_ptr<ngraph::op::v0::ConvolutionBackpropData>(user))
+            {
+                if (target.get_index() == 1 && data->get_data_batch_shape() == data_shape &&
+                    data->get_input_shape(0) == bprop_filters->get_filters_shape() &&
+                    data->get_window_movement_strides_forward() ==
+                        bprop_filters->get_window_movement_strides_forward() &&
+                    data->get_window_dilation_strides_forward() ==
+                        bprop_filters->get_window_dilation_strides_forward() &&
+                    data->get_padding_below_forward() ==
+                        bprop_filters->get_padding_below_forward() &&
+                    data->get_padding_above_forward() ==
+                        bprop_filters->get_padding_above_forward() &&
+                    data->get_data_dilation_strides_forward() ==
+                        bprop_filters->get_data_dilation_strides_forward())
+                {
+                    bprop_data = data;
+                }
+            }
+            else if (auto sum = as_type_ptr<ngraph::op::v0::Sum>(user))
+            {
+                if (sum->reduction_axes_constant() &&
+                    sum->get_reduction_axes() == AxisSet{0, 2, 3})
+                {
+                    bias_sum = sum;
+                }
+            }
+        }
+        if (!bprop_data || !bias_sum)
+        {
+            NGRAPH_DEBUG << "Delta is not shared by data, filters and bias backprop";
+            return false;
+        }
+
+        // Fold the ReluBackprop producing the delta when nothing else reads its result
+        std::shared_ptr<ngraph::op::ConvolutionBiasBackprop> conv_bprop;
+        auto relu_bprop = as_type_ptr<ngraph::op::v0::ReluBackprop>(
+            delta_value.get_node_shared_ptr());
+        if (relu_bprop && delta_value.get_target_inputs().size() == 3)
+        {
+            conv_bprop = std::make_shared<ngraph::op::ConvolutionBiasBackprop>(
+                pvm[data_batch],
+                bprop_data->input_value(0),
+                relu_bprop->input_value(1),
+                relu_bprop->input_value(0),
+                bprop_filters->get_window_movement_strides_forward(),
+                bprop_filters->get_window_dilation_strides_forward(),
+                bprop_filters->get_padding_below_forward(),
+                bprop_filters->get_padding_above_forward(),
+                bprop_filters->get_data_dilation_strides_forward());
+        }
+        else
+        {
+            conv_bprop = std::make_shared<ngraph::op::ConvolutionBiasBackprop>(
+                pvm[data_batch],
+                bprop_data->input_value(0),
+                delta_value,
+                bprop_filters->get_window_movement_strides_forward(),
+                bprop_filters->get_window_dilation_strides_forward(),
+                bprop_filters->get_padding_below_forward(),
+                bprop_filters->get_padding_above_forward(),
+                bprop_filters->get_data_dilation_strides_forward());
+        }
+
+        bprop_data->output(0).replace(conv_bprop->output(0));
+        m.get_match_value().replace(conv_bprop->output(1));
+        bias_sum->output(0).replace(conv_bprop->output(2));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv_bprop_filters,
+                                                        "CPUConvBackpropFusion.ConvBiasBackprop");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_batch_norm_relu()
 {
     auto input_shape = Shape{1, 2, 2, 2};
@@ -1642,6 +1797,447 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_bias_affine_folding()
     this->add_matcher(m, callback);
 }
 
+// Returns the per-channel vector of a Broadcast that repeats a constant along one axis of a
+// rank 2 MatmulBias output, along with that channel axis. Scalars are treated as per-column.
+static bool get_matmul_channel_vector(const std::shared_ptr<ngraph::Node>& node,
+                                      std::shared_ptr<ngraph::Node>& vector,
+                                      size_t& axis)
+{
+    auto bcast = ngraph::as_type_ptr<ngraph::op::v0::Broadcast>(node);
+    if (!bcast || !ngraph::is_type<ngraph::op::v0::Constant>(bcast->get_argument(0)) ||
+        bcast->get_output_shape(0).size() != 2)
+    {
+        return false;
+    }
+
+    auto input_shape = bcast->get_input_shape(0);
+    auto output_shape = bcast->get_output_shape(0);
+    if (shape_size(input_shape) == 1)
+    {
+        axis = 1;
+        vector = std::make_shared<ngraph::op::v0::Broadcast>(
+            std::make_shared<ngraph::op::v0::Reshape>(
+                bcast->input_value(0), ngraph::get_default_order(input_shape), ngraph::Shape{}),
+            ngraph::Shape{output_shape[1]},
+            ngraph::AxisSet{0});
+        return true;
+    }
+    if (input_shape.size() == 1 && bcast->get_broadcast_axes().size() == 1)
+    {
+        axis = 1 - *bcast->get_broadcast_axes().begin();
+        vector = bcast->get_argument(0);
+        return true;
+    }
+    return false;
+}
+
+// Evaluates a subgraph whose leaves are all constants into a single Constant, so that a chain
+// of folds keeps finding a constant operand. Returns nullptr if anything in it is not constant.
+static std::shared_ptr<ngraph::op::v0::Constant>
+    fold_constant_subgraph(const ngraph::Output<ngraph::Node>& value)
+{
+    auto node = value.get_node_shared_ptr();
+    if (auto constant = ngraph::as_type_ptr<ngraph::op::v0::Constant>(node))
+    {
+        return constant;
+    }
+    if (node->get_output_size() != 1 || node->get_input_size() == 0)
+    {
+        return nullptr;
+    }
+    ngraph::OutputVector inputs;
+    for (auto& input : node->input_values())
+    {
+        auto folded = fold_constant_subgraph(input);
+        if (!folded)
+        {
+            return nullptr;
+        }
+        inputs.push_back(folded);
+    }
+    ngraph::OutputVector outputs(1);
+    if (!node->constant_fold(outputs, inputs))
+    {
+        return nullptr;
+    }
+    return ngraph::as_type_ptr<ngraph::op::v0::Constant>(outputs[0].get_node_shared_ptr());
+}
+
+// Returns the subgraph folded into a Constant when it only depends on constants, otherwise the
+// subgraph itself
+static ngraph::Output<ngraph::Node> fold_if_constant(const std::shared_ptr<ngraph::Node>& node)
+{
+    if (auto constant = fold_constant_subgraph(node))
+    {
+        return constant;
+    }
+    return node;
+}
+
+// Folds out' = out * scale + shift, with scale and shift per channel along the given axis of
+// the MatmulBias output, into the matmul operand that owns that axis and into the bias.
+// Either of scale and shift may be null. Returns nullptr if the fold does not apply.
+static std::shared_ptr<ngraph::Node>
+    fold_matmul_bias_affine(const std::shared_ptr<ngraph::op::MatmulBias>& mmb,
+                            size_t axis,
+                            const std::shared_ptr<ngraph::Node>& scale,
+                            const std::shared_ptr<ngraph::Node>& shift)
+{
+    if (mmb->get_users().size() > 1 || mmb->get_output_shape(0).size() != 2 ||
+        mmb->get_output_element_type(0) != ngraph::element::f32)
+    {
+        return nullptr;
+    }
+
+    ngraph::OutputVector args{mmb->input_value(0), mmb->input_value(1)};
+    if (scale)
+    {
+        // Scaling output rows scales the rows of op(W), output columns the columns of op(x)
+        size_t arg = axis == 0 ? 0 : 1;
+        bool transposed = axis == 0 ? mmb->get_is_a_transposed() : mmb->get_is_b_transposed();
+        auto logical_shape = axis == 0 ? mmb->get_a_shape() : mmb->get_b_shape();
+        auto operand = fold_constant_subgraph(args[arg]);
+        if (!operand || args[arg].get_shape() != logical_shape)
+        {
+            NGRAPH_DEBUG << "Matmul operand is not a constant in its logical shape";
+            return nullptr;
+        }
+        size_t bcast_axis = (axis == 0) != transposed ? 1 : 0;
+        args[arg] = fold_if_constant(std::make_shared<ngraph::op::v1::Multiply>(
+            operand,
+            std::make_shared<ngraph::op::v0::Broadcast>(
+                scale, args[arg].get_shape(), ngraph::AxisSet{bcast_axis})));
+    }
+
+    std::shared_ptr<ngraph::Node> bias;
+    if (mmb->get_input_size() > 2)
+    {
+        if (mmb->get_broadcast_axes() != ngraph::AxisSet{1 - axis})
+        {
+            NGRAPH_DEBUG << "Matmul bias is not broadcast along the folded channel";
+            return nullptr;
+        }
+        bias = mmb->get_argument(2);
+        if (scale)
+        {
+            bias = std::make_shared<ngraph::op::v1::Multiply>(bias, scale);
+        }
+    }
+    if (shift)
+    {
+        bias = bias ? std::make_shared<ngraph::op::v1::Add>(bias, shift) : shift;
+    }
+    if (bias)
+    {
+        bias = fold_if_constant(bias).get_node_shared_ptr();
+    }
+
+    return std::make_shared<ngraph::op::MatmulBias>(
+        args[0],
+        args[1],
+        bias ? bias->output(0) : ngraph::Output<ngraph::Node>(),
+        mmb->get_a_shape(),
+        mmb->get_b_shape(),
+        mmb->get_is_a_transposed(),
+        mmb->get_is_b_transposed(),
+        bias ? ngraph::AxisSet{1 - axis} : ngraph::AxisSet{});
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul_bias_folded_batch_norm()
+{
+    // BatchNormInference (MatmulBias (W, x, b)) -> MatmulBias (W, x * A_c, b * A_c + B_c)
+    auto mmb = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, pattern::has_class<ngraph::op::MatmulBias>());
+    auto mean = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto var = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto gamma = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto beta = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    double eps = 0.001;
+    auto bn =
+        std::make_shared<ngraph::op::v0::BatchNormInference>(eps, gamma, beta, mmb, mean, var);
+
+    auto callback = [mmb, mean, var, gamma, beta](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for matmul folded batch norm against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto pvm = m.get_pattern_value_map();
+
+        auto m_bn = m.get_match_root_as<ngraph::op::v0::BatchNormInference>();
+        NGRAPH_CHECK(m_bn,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `ngraph::op::v0::BatchNormInference`");
+
+        for (auto stat : {mean, var, gamma, beta})
+        {
+            if (!is_type<ngraph::op::v0::Constant>(pattern_map[stat]))
+            {
+                NGRAPH_DEBUG << "Batch norm statistics are not constant";
+                return false;
+            }
+        }
+
+        // scale = gamma / sqrt(variance + epsilon)
+        // shift = beta - mean * scale
+        auto bn_eps =
+            ngraph::op::v0::Constant::create(element::f32, Shape{}, {m_bn->get_eps_value()});
+        auto var_eps = std::make_shared<ngraph::op::v1::Add>(
+            pvm[var],
+            std::make_shared<ngraph::op::v0::Broadcast>(bn_eps, pvm[var].get_shape(), AxisSet{0}));
+        auto scale = std::make_shared<ngraph::op::v1::Divide>(
+            pvm[gamma], std::make_shared<ngraph::op::v0::Sqrt>(var_eps));
+        auto shift = std::make_shared<ngraph::op::v1::Subtract>(
+            pvm[beta], std::make_shared<ngraph::op::v1::Multiply>(pvm[mean], scale));
+
+        auto folded = fold_matmul_bias_affine(
+            std::static_pointer_cast<ngraph::op::MatmulBias>(pattern_map[mmb]), 1, scale, shift);
+        if (!folded)
+        {
+            return false;
+        }
+        m.get_match_value().replace(folded->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(bn, "CPUFusion.MatMulBiasFoldedBatchNorm");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul_bias_affine_folding()
+{
+    // A * MatmulBias (W, x, b) -> MatmulBias (W, x * A_c, b * A_c)
+    auto mmb = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, pattern::has_class<ngraph::op::MatmulBias>());
+    auto A = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, pattern::has_class<ngraph::op::v0::Broadcast>());
+    auto multiply = std::make_shared<ngraph::op::v1::Multiply>(mmb, A);
+
+    auto callback = [mmb, A](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for matmul affine folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        std::shared_ptr<Node> scale;
+        size_t axis;
+        if (!get_matmul_channel_vector(pattern_map[A], scale, axis))
+        {
+            return false;
+        }
+
+        auto folded = fold_matmul_bias_affine(
+            std::static_pointer_cast<ngraph::op::MatmulBias>(pattern_map[mmb]),
+            axis,
+            scale,
+            nullptr);
+        if (!folded)
+        {
+            return false;
+        }
+        m.get_match_value().replace(folded->output(0));
+        return true;
+    };
+
+    auto m =
+        std::make_shared<ngraph::pattern::Matcher>(multiply, "CPUFusion.MatMulBiasAffineFolding");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul_bias_shift_folding()
+{
+    // MatmulBias (W, x, b) + B -> MatmulBias (W, x, b + B_c)
+    // MatmulBias without a bias is handled by construct_matmulbias
+    auto mmb = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, [](const Output<Node>& value) {
+            auto node = value.get_node_shared_ptr();
+            return is_type<ngraph::op::MatmulBias>(node) && node->get_input_size() > 2;
+        });
+    auto B = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, pattern::has_class<ngraph::op::v0::Broadcast>());
+    auto add = std::make_shared<ngraph::op::v1::Add>(mmb, B);
+
+    auto callback = [mmb, B](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for matmul shift folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        std::shared_ptr<Node> shift;
+        size_t axis;
+        if (!get_matmul_channel_vector(pattern_map[B], shift, axis))
+        {
+            return false;
+        }
+
+        auto folded = fold_matmul_bias_affine(
+            std::static_pointer_cast<ngraph::op::MatmulBias>(pattern_map[mmb]),
+            axis,
+            nullptr,
+            shift);
+        if (!folded)
+        {
+            return false;
+        }
+        m.get_match_value().replace(folded->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(add, "CPUFusion.MatMulBiasShiftFolding");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_input_affine_folding()
+{
+    // Convolution (x * A + B, filters) -> ConvolutionBias (x, filters * A_c, Sum (filters * B_c))
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 2, 1, 1});
+    auto affine = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2, 1, 1}, [](const Output<Node>& value) {
+            auto node = value.get_node_shared_ptr();
+            return is_type<ngraph::op::v1::Add>(node) || is_type<ngraph::op::v1::Multiply>(node);
+        });
+    auto filters = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 2, 1, 1});
+    auto conv = std::make_shared<ngraph::op::v0::Convolution>(affine,
+                                                              filters,
+                                                              Strides{1, 1},
+                                                              Strides{1, 1},
+                                                              CoordinateDiff{0, 0},
+                                                              CoordinateDiff{0, 0},
+                                                              Strides{1, 1});
+
+    auto callback = [affine, filters](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for conv input affine folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+        auto pvm = m.get_pattern_value_map();
+
+        auto conv_m = m.get_match_root_as<ngraph::op::v0::Convolution>();
+        NGRAPH_CHECK(conv_m,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `ngraph::op::v0::Convolution`");
+        if (conv_m->get_output_shape(0).size() != 4 ||
+            !is_type<ngraph::op::v0::Constant>(pattern_map[filters]))
+        {
+            return false;
+        }
+        // Like padding, the holes of a dilated input would lose the shift
+        for (auto stride : conv_m->get_data_dilation_strides())
+        {
+            if (stride != 1)
+            {
+                return false;
+            }
+        }
+
+        // Returns the per input channel vector of a constant broadcast along axes {0, 2, 3}
+        auto get_channel_vector = [](const std::shared_ptr<Node>& node) {
+            auto bcast = as_type_ptr<ngraph::op::v0::Broadcast>(node);
+            if (bcast && is_type<ngraph::op::v0::Constant>(bcast->get_argument(0)) &&
+                bcast->get_input_shape(0).size() == 1 &&
+                bcast->get_broadcast_axes() == AxisSet{0, 2, 3})
+            {
+                return bcast->get_argument(0);
+            }
+            return std::shared_ptr<Node>();
+        };
+        // Splits a binary op into its per-channel constant operand and the other operand
+        auto split_affine = [&](const std::shared_ptr<Node>& node,
+                                std::shared_ptr<Node>& vector,
+                                Output<Node>& other) {
+            for (size_t i = 0; i < 2; i++)
+            {
+                vector = get_channel_vector(node->get_argument(i));
+                if (vector)
+                {
+                    other = node->input_value(1 - i);
+                    return node->get_users().size() == 1;
+                }
+            }
+            return false;
+        };
+
+        std::shared_ptr<Node> scale, shift;
+        Output<Node> data = pvm[affine];
+        if (is_type<ngraph::op::v1::Add>(data.get_node_shared_ptr()))
+        {
+            if (!split_affine(data.get_node_shared_ptr(), shift, data))
+            {
+                return false;
+            }
+            // Padded positions would see the shift before folding but not after
+            for (auto pad : conv_m->get_padding_below())
+            {
+                if (pad != 0)
+                {
+                    return false;
+                }
+            }
+            for (auto pad : conv_m->get_padding_above())
+            {
+                if (pad != 0)
+                {
+                    return false;
+                }
+            }
+        }
+        if (is_type<ngraph::op::v1::Multiply>(data.get_node_shared_ptr()) &&
+            !split_affine(data.get_node_shared_ptr(), scale, data))
+        {
+            return false;
+        }
+        if (!scale && !shift)
+        {
+            return false;
+        }
+
+        // new filters = filters * A_c
+        // new bias = Sum over input channel and window of (filters * B_c)
+        auto filters_shape = pvm[filters].get_shape();
+        Output<Node> filters_n = pvm[filters];
+        if (scale)
+        {
+            filters_n = std::make_shared<ngraph::op::v1::Multiply>(
+                filters_n,
+                std::make_shared<ngraph::op::v0::Broadcast>(
+                    scale, filters_shape, AxisSet{0, 2, 3}));
+        }
+
+        std::shared_ptr<Node> conv_n;
+        if (shift)
+        {
+            auto bias_n = std::make_shared<ngraph::op::v0::Sum>(
+                std::make_shared<ngraph::op::v1::Multiply>(
+                    pvm[filters],
+                    std::make_shared<ngraph::op::v0::Broadcast>(
+                        shift, filters_shape, AxisSet{0, 2, 3})),
+                AxisSet{1, 2, 3});
+            conv_n = std::make_shared<ngraph::op::v0::ConvolutionBias>(
+                data,
+                filters_n,
+                bias_n,
+                conv_m->get_window_movement_strides(),
+                conv_m->get_window_dilation_strides(),
+                conv_m->get_padding_below(),
+                conv_m->get_padding_above(),
+                conv_m->get_data_dilation_strides());
+        }
+        else
+        {
+            conv_n = std::make_shared<ngraph::op::v0::Convolution>(
+                data,
+                filters_n,
+                conv_m->get_window_movement_strides(),
+                conv_m->get_window_dilation_strides(),
+                conv_m->get_padding_below(),
+                conv_m->get_padding_above(),
+                conv_m->get_data_dilation_strides());
+        }
+        m.get_match_value().replace(conv_n->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(conv, "CPUFusion.ConvInputAffineFolding");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_groupconv_batchnorm_global_stats_folding()
 {
     Shape shape_a{1, 32, 2, 2};
@@ -2021,6 +2617,186 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_update_slice()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::CPUFusion::construct_sgd_momentum_update()
+{
+    auto is_constant = [](Output<Node> n) {
+        return (is_type<ngraph::op::v0::Constant>(n.get_node()));
+    };
+    auto broadcast_pred = [](Output<Node> n) {
+        return (is_type<ngraph::op::v0::Broadcast>(n.get_node()));
+    };
+    auto iconst = ngraph::op::v0::Constant::create(element::f32, Shape{}, {1});
+
+    auto param = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto grad = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto velocity = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto momentum = std::make_shared<pattern::op::Label>(iconst, is_constant);
+    auto learning_rate = std::make_shared<pattern::op::Label>(iconst, is_constant);
+
+    // v' = momentum * v + grad
+    auto velocity_mul = std::make_shared<ngraph::op::v1::Multiply>(
+        velocity, std::make_shared<pattern::op::Skip>(momentum, broadcast_pred));
+    auto new_velocity = std::make_shared<ngraph::op::v1::Add>(velocity_mul, grad);
+    auto new_velocity_label =
+        std::make_shared<pattern::op::Label>(new_velocity, nullptr, OutputVector{new_velocity});
+    // param' = param - learning_rate * v'
+    auto step = std::make_shared<ngraph::op::v1::Multiply>(
+        std::make_shared<pattern::op::Skip>(learning_rate, broadcast_pred), new_velocity_label);
+    auto new_param = std::make_shared<ngraph::op::v1::Subtract>(param, step);
+
+    auto callback =
+        [param, grad, velocity, momentum, learning_rate, new_velocity_label](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In a callback for construct_sgd_momentum_update against "
+                         << m.get_match_root()->get_name();
+            auto pattern_map = m.get_pattern_map();
+
+            auto shape = m.get_match_value().get_shape();
+            if (m.get_match_value().get_element_type() != element::f32 ||
+                pattern_map[param]->get_output_shape(0) != shape ||
+                pattern_map[grad]->get_output_shape(0) != shape ||
+                pattern_map[velocity]->get_output_shape(0) != shape)
+            {
+                NGRAPH_DEBUG << "Update tensors are not f32 tensors of the same shape";
+                return false;
+            }
+
+            float momentum_value;
+            float learning_rate_value;
+            if (!get_uniform_constant(pattern_map[momentum], momentum_value) ||
+                !get_uniform_constant(pattern_map[learning_rate], learning_rate_value))
+            {
+                NGRAPH_DEBUG << "Hyperparameters are not scalar constants";
+                return false;
+            }
+
+            auto update = std::make_shared<ngraph::op::OptimizerUpdate>(
+                OutputVector{pattern_map[param], pattern_map[grad], pattern_map[velocity]},
+                ngraph::op::OptimizerUpdate::Algorithm::SGDMomentum,
+                learning_rate_value,
+                momentum_value);
+            pattern_map[new_velocity_label]->output(0).replace(update->output(1));
+            m.get_match_value().replace(update->output(0));
+            return true;
+        };
+
+    auto m = std::make_shared<pattern::Matcher>(new_param, "CPUFusion.SGDMomentumUpdate");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_adam_update()
+{
+    auto is_constant = [](Output<Node> n) {
+        return (is_type<ngraph::op::v0::Constant>(n.get_node()));
+    };
+    auto broadcast_pred = [](Output<Node> n) {
+        return (is_type<ngraph::op::v0::Broadcast>(n.get_node()));
+    };
+    auto iconst = ngraph::op::v0::Constant::create(element::f32, Shape{}, {1});
+    auto constant_label = [&]() {
+        return std::make_shared<pattern::op::Label>(iconst, is_constant);
+    };
+
+    auto param = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto grad = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto m_state = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto v_state = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto beta1 = constant_label();
+    auto one_minus_beta1 = constant_label();
+    auto beta2 = constant_label();
+    auto one_minus_beta2 = constant_label();
+    auto learning_rate = constant_label();
+    auto epsilon = constant_label();
+    auto skip = [&](std::shared_ptr<pattern::op::Label> label) {
+        return std::make_shared<pattern::op::Skip>(label, broadcast_pred);
+    };
+
+    // m' = beta1 * m + (1 - beta1) * grad
+    auto new_m = std::make_shared<ngraph::op::v1::Add>(
+        std::make_shared<ngraph::op::v1::Multiply>(m_state, skip(beta1)),
+        std::make_shared<ngraph::op::v1::Multiply>(grad, skip(one_minus_beta1)));
+    auto new_m_label = std::make_shared<pattern::op::Label>(new_m, nullptr, OutputVector{new_m});
+    // v' = beta2 * v + (1 - beta2) * grad * grad
+    auto new_v = std::make_shared<ngraph::op::v1::Add>(
+        std::make_shared<ngraph::op::v1::Multiply>(v_state, skip(beta2)),
+        std::make_shared<ngraph::op::v1::Multiply>(
+            std::make_shared<ngraph::op::v1::Multiply>(grad, grad), skip(one_minus_beta2)));
+    auto new_v_label = std::make_shared<pattern::op::Label>(new_v, nullptr, OutputVector{new_v});
+    // param' = param - learning_rate * m' / (sqrt(v') + epsilon)
+    auto denom = std::make_shared<ngraph::op::v1::Add>(
+        std::make_shared<ngraph::op::v0::Sqrt>(new_v_label), skip(epsilon));
+    auto step = std::make_shared<ngraph::op::v1::Multiply>(
+        skip(learning_rate), std::make_shared<ngraph::op::v1::Divide>(new_m_label, denom));
+    auto new_param = std::make_shared<ngraph::op::v1::Subtract>(param, step);
+
+    auto callback = [param,
+                     grad,
+                     m_state,
+                     v_state,
+                     beta1,
+                     one_minus_beta1,
+                     beta2,
+                     one_minus_beta2,
+                     learning_rate,
+                     epsilon,
+                     new_m_label,
+                     new_v_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_adam_update against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto shape = m.get_match_value().get_shape();
+        if (m.get_match_value().get_element_type() != element::f32 ||
+            pattern_map[param]->get_output_shape(0) != shape ||
+            pattern_map[grad]->get_output_shape(0) != shape ||
+            pattern_map[m_state]->get_output_shape(0) != shape ||
+            pattern_map[v_state]->get_output_shape(0) != shape)
+        {
+            NGRAPH_DEBUG << "Update tensors are not f32 tensors of the same shape";
+            return false;
+        }
+
+        float beta1_value, one_minus_beta1_value, beta2_value, one_minus_beta2_value;
+        float learning_rate_value, epsilon_value;
+        if (!get_uniform_constant(pattern_map[beta1], beta1_value) ||
+            !get_uniform_constant(pattern_map[one_minus_beta1], one_minus_beta1_value) ||
+            !get_uniform_constant(pattern_map[beta2], beta2_value) ||
+            !get_uniform_constant(pattern_map[one_minus_beta2], one_minus_beta2_value) ||
+            !get_uniform_constant(pattern_map[learning_rate], learning_rate_value) ||
+            !get_uniform_constant(pattern_map[epsilon], epsilon_value))
+        {
+            NGRAPH_DEBUG << "Hyperparameters are not scalar constants";
+            return false;
+        }
+
+        // The fused kernel derives the gradient weights from the betas
+        const float tolerance = 1e-6f;
+        if (std::abs(beta1_value + one_minus_beta1_value - 1.0f) > tolerance ||
+            std::abs(beta2_value + one_minus_beta2_value - 1.0f) > tolerance)
+        {
+            NGRAPH_DEBUG << "Moment weights do not add up to one";
+            return false;
+        }
+
+        auto update = std::make_shared<ngraph::op::OptimizerUpdate>(
+            OutputVector{pattern_map[param],
+                         pattern_map[grad],
+                         pattern_map[m_state],
+                         pattern_map[v_state]},
+            ngraph::op::OptimizerUpdate::Algorithm::Adam,
+            learning_rate_value,
+            beta1_value,
+            beta2_value,
+            epsilon_value);
+        pattern_map[new_m_label]->output(0).replace(update->output(1));
+        pattern_map[new_v_label]->output(0).replace(update->output(2));
+        m.get_match_value().replace(update->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(new_param, "CPUFusion.AdamUpdate");
+    this->add_matcher(m, callback);
+}
+
 // QuantizedConvolution + Dequantize + Relu -> QuantizedConvolutionRelu + Dequantize
 void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconv_relu(bool with_bias)
 {
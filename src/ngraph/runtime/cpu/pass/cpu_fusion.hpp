@@ -31,6 +31,7 @@ namespace ngraph
             {
                 class CPUPreFusion;
                 class CPUFusion;
+                class CPUConvBackpropFusion;
                 class CPUQuantFusion;
             }
         }
@@ -72,6 +73,10 @@ public:
             construct_conv_bias_bprop();
             construct_conv_bias_folded_batch_norm();
             construct_conv_bias_affine_folding();
+            construct_conv_input_affine_folding();
+            construct_matmul_bias_folded_batch_norm();
+            construct_matmul_bias_affine_folding();
+            construct_matmul_bias_shift_folding();
             construct_groupconv_batchnorm_global_stats_folding();
             construct_groupconv_batchnorm_global_stats_folding_relu();
             construct_batch_norm_relu();
@@ -94,6 +99,8 @@ public:
             }
             construct_dropout();
             construct_batch_norm_infer_relu_with_multiply_add();
+            construct_sgd_momentum_update();
+            construct_adam_update();
         }
     }
 
@@ -117,12 +124,35 @@ private:
     void construct_bounded_relu();
     void construct_conv_bias_folded_batch_norm();
     void construct_conv_bias_affine_folding();
+    void construct_conv_input_affine_folding();
+    void construct_matmul_bias_folded_batch_norm();
+    void construct_matmul_bias_affine_folding();
+    void construct_matmul_bias_shift_folding();
     void construct_groupconv_batchnorm_global_stats_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
     void construct_update_slice();
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
     void construct_dropout();
+    void construct_sgd_momentum_update();
+    void construct_adam_update();
+};
+
+/// \brief Fuses the data, filters and bias gradients of a convolution that share one delta,
+/// and the ReluBackprop producing that delta, into op::ConvolutionBiasBackprop.
+/// The fused op has a DNNL kernel only and is not supported by codegen.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUConvBackpropFusion
+    : public ngraph::pass::GraphRewrite
+{
+public:
+    CPUConvBackpropFusion()
+        : GraphRewrite()
+    {
+        construct_conv_bias_backprop();
+    }
+
+private:
+    void construct_conv_bias_backprop();
 };
 
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUQuantFusion : public ngraph::pass::GraphRewrite
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <map>
+#include <tuple>
+
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
@@ -21,11 +24,13 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/conv_fused.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -196,3 +201,85 @@ void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_conv_horizontal_fusion
         make_shared<pattern::Matcher>(conv_bias, "CPUHorizontalFusion.CpuConvHorizontalFusion");
     this->add_matcher(m, callback);
 }
+
+bool ngraph::runtime::cpu::pass::CPUOptimizerUpdateFusion::run_on_function(
+    std::shared_ptr<ngraph::Function> function)
+{
+    using Key = std::tuple<int, float, float, float, float, float>;
+    std::map<Key, std::vector<std::shared_ptr<op::OptimizerUpdate>>> groups;
+
+    for (auto node : function->get_ordered_ops())
+    {
+        auto update = as_type_ptr<op::OptimizerUpdate>(node);
+        if (!update)
+        {
+            continue;
+        }
+
+        bool feeds_results_only = true;
+        for (auto& output : update->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                if (!is_type<op::v0::Result>(input.get_node()))
+                {
+                    feeds_results_only = false;
+                }
+            }
+        }
+        if (!feeds_results_only)
+        {
+            NGRAPH_DEBUG << "optimizer_update_fusion: " << update->get_name()
+                         << " has users other than results\n";
+            continue;
+        }
+
+        Key key{static_cast<int>(update->get_algorithm()),
+                update->get_learning_rate(),
+                update->get_beta1(),
+                update->get_beta2(),
+                update->get_epsilon(),
+                update->get_weight_decay()};
+        groups[key].push_back(update);
+    }
+
+    bool modified = false;
+    for (auto& group : groups)
+    {
+        auto& updates = group.second;
+        if (updates.size() <= 1)
+        {
+            continue;
+        }
+
+        OutputVector args;
+        for (auto update : updates)
+        {
+            for (auto& value : update->input_values())
+            {
+                args.push_back(value);
+            }
+        }
+        auto first = updates.front();
+        auto merged = std::make_shared<op::OptimizerUpdate>(args,
+                                                            first->get_algorithm(),
+                                                            first->get_learning_rate(),
+                                                            first->get_beta1(),
+                                                            first->get_beta2(),
+                                                            first->get_epsilon(),
+                                                            first->get_weight_decay());
+        NGRAPH_DEBUG << "optimizer_update_fusion: merged " << updates.size() << " updates into "
+                     << merged->get_name() << "\n";
+
+        size_t index = 0;
+        for (auto update : updates)
+        {
+            for (auto& output : update->outputs())
+            {
+                output.replace(merged->output(index++));
+            }
+        }
+        modified = true;
+    }
+    return modified;
+}
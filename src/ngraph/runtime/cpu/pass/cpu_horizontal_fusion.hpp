@@ -27,6 +27,7 @@ namespace ngraph
             namespace pass
             {
                 class CPUHorizontalFusion;
+                class CPUOptimizerUpdateFusion;
             }
         }
     }
@@ -44,3 +45,13 @@ public:
 private:
     void cpu_conv_horizontal_fusion();
 };
+
+/// \brief Merges independent op::OptimizerUpdate nodes that share an algorithm and
+/// hyperparameters into one node, so that all their parameters are updated in one
+/// parallel pass. Only nodes whose outputs feed Results alone are merged, which rules
+/// out dependencies between the merged updates.
+class ngraph::runtime::cpu::pass::CPUOptimizerUpdateFusion : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
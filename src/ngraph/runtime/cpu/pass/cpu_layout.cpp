@@ -58,6 +58,7 @@
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
@@ -1138,6 +1139,123 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::ConvolutionBiasBackprop)
+                {
+                    if (dnnl_utils::use_dnnl_kernel(node.get()))
+                    {
+                        auto convolution =
+                            static_cast<const ngraph::op::ConvolutionBiasBackprop*>(node.get());
+
+                        auto data_shape = node->get_input_shape(0);
+                        auto filters_shape = node->get_input_shape(1);
+                        auto delta_shape = node->get_input_shape(2);
+                        auto bias_shape = node->get_output_shape(2);
+                        auto filter_strides = convolution->get_window_movement_strides_forward();
+                        auto padding_below = convolution->get_padding_below_forward();
+                        auto padding_above = convolution->get_padding_above_forward();
+
+                        Strides window_dilation_strides_adjusted;
+                        for (size_t s : convolution->get_window_dilation_strides_forward())
+                        {
+                            window_dilation_strides_adjusted.push_back(s - 1);
+                        }
+
+                        memory::data_type et =
+                            dnnl_utils::get_dnnl_data_type(node->get_input_element_type(0));
+
+                        memory::dims dnnl_data_shape(data_shape.begin(), data_shape.end());
+                        memory::dims dnnl_filters_shape(filters_shape.begin(),
+                                                        filters_shape.end());
+                        memory::dims dnnl_delta_shape(delta_shape.begin(), delta_shape.end());
+                        memory::dims dnnl_bias_shape(bias_shape.begin(), bias_shape.end());
+                        memory::dims dnnl_filter_strides(filter_strides.begin(),
+                                                         filter_strides.end());
+                        memory::dims dnnl_dilated_strides(window_dilation_strides_adjusted.begin(),
+                                                          window_dilation_strides_adjusted.end());
+                        memory::dims dnnl_padding_below(padding_below.begin(), padding_below.end());
+                        memory::dims dnnl_padding_above(padding_above.begin(), padding_above.end());
+
+                        const memory::desc data_desc(dnnl_data_shape, et, memory::FORMAT::any);
+                        const memory::desc filters_desc(
+                            dnnl_filters_shape, et, memory::FORMAT::any);
+                        const memory::desc delta_desc(dnnl_delta_shape, et, memory::FORMAT::any);
+                        const memory::desc bias_desc(dnnl_bias_shape, et, memory::FORMAT::any);
+
+                        // The weights gradient picks the delta layout ...
+                        convolution_forward::desc weights_fwd_desc(prop_kind::forward,
+                                                                   algorithm::convolution_direct,
+                                                                   data_desc,
+                                                                   filters_desc,
+                                                                   bias_desc,
+                                                                   delta_desc,
+                                                                   dnnl_filter_strides,
+                                                                   dnnl_dilated_strides,
+                                                                   dnnl_padding_below,
+                                                                   dnnl_padding_above PADDING);
+                        convolution_forward::primitive_desc weights_fwd_prim_desc(
+                            weights_fwd_desc, executor::global_cpu_engine);
+                        convolution_backward_weights::desc weights_desc(
+                            algorithm::convolution_direct,
+                            data_desc,
+                            filters_desc,
+                            bias_desc,
+                            delta_desc,
+                            dnnl_filter_strides,
+                            dnnl_dilated_strides,
+                            dnnl_padding_below,
+                            dnnl_padding_above PADDING);
+                        convolution_backward_weights::primitive_desc weights_prim_desc(
+                            weights_desc, executor::global_cpu_engine, weights_fwd_prim_desc);
+
+                        // ... and the data gradient reads the delta in that same layout, so it
+                        // is converted at most once
+                        auto shared_delta_desc = weights_prim_desc.diff_dst_desc();
+                        convolution_forward::desc data_fwd_desc(prop_kind::forward,
+                                                                algorithm::convolution_direct,
+                                                                data_desc,
+                                                                filters_desc,
+                                                                shared_delta_desc,
+                                                                dnnl_filter_strides,
+                                                                dnnl_dilated_strides,
+                                                                dnnl_padding_below,
+                                                                dnnl_padding_above PADDING);
+                        convolution_forward::primitive_desc data_fwd_prim_desc(
+                            data_fwd_desc, executor::global_cpu_engine);
+                        convolution_backward_data::desc data_bwd_desc(
+                            algorithm::convolution_direct,
+                            data_desc,
+                            filters_desc,
+                            shared_delta_desc,
+                            dnnl_filter_strides,
+                            dnnl_dilated_strides,
+                            dnnl_padding_below,
+                            dnnl_padding_above PADDING);
+                        convolution_backward_data::primitive_desc data_prim_desc(
+                            data_bwd_desc, executor::global_cpu_engine, data_fwd_prim_desc);
+
+                        vector<memory::desc> i_mds;
+                        vector<memory::desc> o_mds;
+                        i_mds.push_back(weights_prim_desc.src_desc());
+                        i_mds.push_back(data_prim_desc.weights_desc());
+                        i_mds.push_back(shared_delta_desc);
+                        if (convolution->with_relu())
+                        {
+                            i_mds.push_back(shared_delta_desc);
+                        }
+                        o_mds.push_back(data_prim_desc.diff_src_desc());
+                        o_mds.push_back(weights_prim_desc.diff_weights_desc());
+                        o_mds.push_back(weights_prim_desc.diff_bias_desc());
+
+                        node = insert_input_conversions(external_function, node, i_mds);
+                        set_output_layouts(node, o_mds);
+                    }
+                    else
+                    {
+                        throw ngraph_error("ConvolutionBiasBackprop is only supported with DNNL");
+                    }
+                }
+
                 template <typename T>
                 void AvgPoolLayout(std::shared_ptr<ngraph::Node> node,
                                    vector<memory::desc>& i_mds,
@@ -2321,6 +2439,8 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::ConvolutionBiasAdd>},
     {TI(ngraph::op::v0::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::ConvolutionBiasBackpropFiltersBias>},
+    {TI(ngraph::op::ConvolutionBiasBackprop),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::ConvolutionBiasBackprop>},
     {TI(ngraph::op::v0::BatchNormTraining),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::BatchNormTraining>},
     {TI(ngraph::op::v0::BatchNormInference),
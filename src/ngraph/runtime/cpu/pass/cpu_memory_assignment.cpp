@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
 #include <sstream>
 
@@ -35,9 +36,11 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    bool concurrent_execution)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_concurrent_execution(concurrent_execution)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -653,12 +656,43 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    // Outputs nobody reads are written to a scratch sink at the end of the pool instead of
+    // taking pool space of their own. They are still computed. Each node gets its dead outputs
+    // laid out side by side in a slot of the sink, so a kernel that reads back one of its
+    // outputs still sees its own data. Nodes run one at a time share a single slot; nodes that
+    // may run concurrently each get their own.
+    vector<pair<descriptor::Tensor*, size_t>> sink_offsets;
+    size_t sink_size = 0;
+
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant() || node->is_output())
         {
             continue;
         }
+        unordered_set<descriptor::Tensor*> dead;
+        if (!m_disable_memory_sharing)
+        {
+            size_t node_sink_start = m_concurrent_execution ? sink_size : 0;
+            size_t node_sink_size = 0;
+            for (auto output : node->outputs())
+            {
+                auto tensor = &output.get_tensor();
+                auto buffer_it = m_bufferID_to_tensorSets.find(get_bufferID(tensor));
+                if (output.get_target_inputs().empty() &&
+                    buffer_it->second.first == TensorRole::INTERMEDIATE &&
+                    buffer_it->second.second.size() == 1 &&
+                    node->liveness_new_list.count(tensor) != 0)
+                {
+                    dead.insert(tensor);
+                    sink_offsets.emplace_back(tensor, node_sink_start + node_sink_size);
+                    node_sink_size += ngraph::pass::MemoryManager::align(tensor->size(),
+                                                                         m_alignment);
+                }
+            }
+            sink_size = std::max(sink_size, node_sink_start + node_sink_size);
+        }
+
         // handle destructive oi pair
         unordered_set<descriptor::Tensor*> no_free;
         unordered_set<descriptor::Tensor*> no_new;
@@ -762,7 +796,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            if (no_new.find(tensor) != no_new.end())
+            if (no_new.find(tensor) != no_new.end() || dead.find(tensor) != dead.end())
             {
                 continue;
             }
@@ -834,13 +868,26 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    // the sink goes after both memory managers
+    auto pool_size = start + mm_caching.max_allocated();
+    if (sink_size > 0)
+    {
+        auto sink_start = ngraph::pass::MemoryManager::align(pool_size, m_alignment);
+        for (auto& item : sink_offsets)
+        {
+            item.first->set_pool_offset(sink_start + item.second);
+        }
+        pool_size = sink_start + sink_size;
+    }
+
     NGRAPH_DEBUG << "cpu_memory_assignemnt: max allocated for mm is " << mm.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated for mm_caching is "
                  << mm_caching.max_allocated();
-    NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
-                 << mm.max_allocated() + mm_caching.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignment: sink for " << sink_offsets.size()
+                 << " dead outputs is " << sink_size;
+    NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is " << pool_size;
 
-    function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
+    function->set_temporary_pool_size(pool_size);
 
     return false;
 }
@@ -14,8 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <iterator>
-
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/convolution.hpp"
@@ -42,13 +41,18 @@ using namespace ngraph;
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
                                                        bool enable_performance_collection)
-    : m_wrapped_function(wrapped_function)
+    : m_wrapped_function(clone_function(*wrapped_function))
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
 {
+    // Subgraphs that do not depend on any parameter (e.g. reshaped or transposed weights) are
+    // folded once here rather than in every specialization, which then only folds what depends
+    // on its shapes. The clone shares constant data with wrapped_function.
     pass::Manager passes;
+    passes.register_pass<pass::ConstantFolding>();
     passes.register_pass<pass::ShapeRelevance>();
     passes.run_passes(m_wrapped_function);
+    m_shape_program = make_shared<ShapeProgram>(m_wrapped_function);
 
     set_parameters_and_results(*wrapped_function);
 }
@@ -84,45 +88,41 @@ bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
+    // We cache on:
     // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
+    // (2) the values that reach shape-relevant inputs, as computed by the shape program, or the
+    //     values of the shape-relevant input tensors if the program is not usable.
 
-    std::vector<int> merged_input_shapes;
-    std::ostringstream key;
-    size_t loop_count = 0;
+    std::vector<int64_t> merged_input_shapes;
     for (auto& input : inputs)
     {
-        if (m_wrapped_function->get_parameters()[loop_count]->is_relevant_to_shapes())
+        for (auto dim : input->get_shape())
         {
-            // Caching on values of Shape relevant inputs
-            int size = input->get_size_in_bytes() / (input->get_element_type().bitwidth() / 8);
-            std::vector<int64_t> data(size);
-            input->read(data.data(), input->get_size_in_bytes());
-            for (int i = 0; i < input->get_element_count(); i++)
-            {
-                merged_input_shapes.emplace_back(data[i]);
-            }
-        }
-        else
-        {
-            // Caching on all remaining shapes
-            for (int i = 0; i < input->get_shape().size(); i++)
-            {
-                merged_input_shapes.emplace_back(input->get_shape()[i]);
-            }
+            merged_input_shapes.emplace_back(dim);
         }
         // -1 is the separator.
         // So if shape of Input 1 = {2, 2, 3, 3} & Input 2 = {4, 5}
         // the key would be 2, 2, 3, 3, -1, 4, 5, -1
         merged_input_shapes.emplace_back(-1);
-        loop_count++;
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
+    // A leading 0 or 1 keeps keys built from the two kinds of values apart
+    merged_input_shapes.emplace_back(0);
+    if (!m_shape_program->evaluate(inputs, merged_input_shapes))
+    {
+        merged_input_shapes.back() = 1;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+            {
+                // Caching on the bytes of shape relevant inputs, whatever their element type
+                std::vector<unsigned char> data(inputs[i]->get_size_in_bytes());
+                inputs[i]->read(data.data(), data.size());
+                merged_input_shapes.emplace_back(data.size());
+                merged_input_shapes.insert(merged_input_shapes.end(), data.begin(), data.end());
+            }
+        }
+    }
 
     if (m_cache->is_cached(merged_input_shapes))
     {
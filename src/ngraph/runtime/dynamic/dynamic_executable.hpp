@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/dynamic/shape_program.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/executable_cache.hpp"
 
@@ -48,6 +49,12 @@ namespace ngraph
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Each clone is a deep copy of every node, since the passes run on it rewrite nodes in
+/// place. Only constant data is shared with the stored function, and subgraphs that do not
+/// depend on any parameter are folded into constants once, when the stored function is set
+/// up. Specializing therefore still costs time in proportion to the whole graph, though not
+/// the memory of its constants.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -62,6 +69,7 @@ public:
 private:
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::shared_ptr<ShapeProgram> m_shape_program;
     std::shared_ptr<ngraph::runtime::ExecutableCache> m_cache =
         std::make_shared<ngraph::runtime::ExecutableCache>();
     bool m_enable_performance_collection;
@@ -69,8 +69,15 @@ const ngraph::Shape& runtime::dynamic::DynamicTensor::get_shape() const
     return m_wrapped_tensor->get_shape();
 }
 
+runtime::dynamic::DynamicTensor::~DynamicTensor()
+{
+    // A staged write may still target the wrapped tensor
+    wait_for_pending_write_nothrow();
+}
+
 void runtime::dynamic::DynamicTensor::write(const void* p, size_t n)
 {
+    wait_for_pending_write();
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
                  "tried to write to a dynamic tensor with no allocated storage");
     m_wrapped_tensor->write(p, n);
@@ -78,6 +85,7 @@ void runtime::dynamic::DynamicTensor::write(const void* p, size_t n)
 
 void runtime::dynamic::DynamicTensor::read(void* p, size_t n) const
 {
+    wait_for_pending_write();
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
                  "tried to read from a dynamic tensor with no allocated storage");
     m_wrapped_tensor->read(p, n);
@@ -85,6 +93,7 @@ void runtime::dynamic::DynamicTensor::read(void* p, size_t n) const
 
 void runtime::dynamic::DynamicTensor::copy_from(const ngraph::runtime::Tensor& source)
 {
+    wait_for_pending_write();
     NGRAPH_CHECK(m_wrapped_tensor != nullptr,
                  "tried to copy_from to a dynamic tensor with no allocated storage");
     m_wrapped_tensor->copy_from(source);
@@ -97,6 +106,7 @@ bool runtime::dynamic::DynamicTensor::has_storage() const
 
 void runtime::dynamic::DynamicTensor::release_storage()
 {
+    wait_for_pending_write();
     m_wrapped_tensor = nullptr;
 }
 
@@ -114,6 +124,7 @@ void runtime::dynamic::DynamicTensor::make_storage(const element::Type& element_
                  shape,
                  " which is incompatible with dynamic tensor shape ",
                  get_partial_shape());
+    wait_for_pending_write();
     m_wrapped_tensor = m_wrapped_backend->create_tensor(element_type, shape);
 }
 
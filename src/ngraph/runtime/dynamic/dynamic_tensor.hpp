@@ -59,6 +59,7 @@ public:
     DynamicTensor(const element::Type& element_type,
                   const PartialShape& shape,
                   const std::shared_ptr<runtime::Backend>& wrapped_backend);
+    virtual ~DynamicTensor() override;
     virtual ngraph::Strides get_strides() const override;
     virtual size_t get_size_in_bytes() const override;
     virtual size_t get_element_count() const override;
@@ -0,0 +1,488 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <list>
+#include <set>
+#include <unordered_map>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/gather.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/range.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/shape_of.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/runtime/dynamic/shape_program.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+template <typename T>
+static vector<int64_t> read_as(runtime::Tensor& tensor)
+{
+    vector<T> data(tensor.get_element_count());
+    tensor.read(data.data(), data.size() * sizeof(T));
+    return vector<int64_t>(data.begin(), data.end());
+}
+
+static vector<int64_t> read_values(runtime::Tensor& tensor)
+{
+    switch (tensor.get_element_type())
+    {
+    case element::Type_t::boolean: return read_as<char>(tensor);
+    case element::Type_t::i8: return read_as<int8_t>(tensor);
+    case element::Type_t::i16: return read_as<int16_t>(tensor);
+    case element::Type_t::i32: return read_as<int32_t>(tensor);
+    case element::Type_t::i64: return read_as<int64_t>(tensor);
+    case element::Type_t::u8: return read_as<uint8_t>(tensor);
+    case element::Type_t::u16: return read_as<uint16_t>(tensor);
+    case element::Type_t::u32: return read_as<uint32_t>(tensor);
+    case element::Type_t::u64: return read_as<uint64_t>(tensor);
+    default: throw ngraph_error("Shape program input must have an integral element type");
+    }
+}
+
+runtime::dynamic::ShapeProgram::ShapeProgram(const shared_ptr<Function>& f)
+    : m_valid(true)
+{
+    for (auto& parameter : f->get_parameters())
+    {
+        m_parameters.push_back(parameter.get());
+    }
+
+    // The same closure as in pass::ShapeRelevance: start from the nodes that feed a
+    // shape-relevant input and do not follow value-irrelevant inputs.
+    set<Node*> determinants;
+    list<Node*> to_visit;
+    for (auto& node : f->get_ops())
+    {
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                if (input.get_is_relevant_to_shapes())
+                {
+                    to_visit.push_back(node.get());
+                }
+            }
+        }
+    }
+    while (!to_visit.empty())
+    {
+        auto node = to_visit.front();
+        to_visit.pop_front();
+        if (!determinants.insert(node).second)
+        {
+            continue;
+        }
+        for (auto& input : node->inputs())
+        {
+            if (input.get_is_relevant_to_values())
+            {
+                to_visit.push_back(input.get_source_output().get_node());
+            }
+        }
+    }
+
+    // A determinant that also feeds data would make results depend on more than the values
+    // computed here
+    for (auto node : determinants)
+    {
+        for (auto& output : node->outputs())
+        {
+            for (auto& input : output.get_target_inputs())
+            {
+                if (determinants.count(input.get_node()) == 0 &&
+                    input.get_is_relevant_to_values() && !input.get_is_relevant_to_shapes())
+                {
+                    NGRAPH_DEBUG << "Shape program: " << node->get_name() << " feeds data of "
+                                 << input.get_node()->get_name();
+                    m_valid = false;
+                    return;
+                }
+            }
+        }
+    }
+
+    unordered_map<Node*, size_t> instruction_index;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (determinants.count(node.get()) == 0)
+        {
+            continue;
+        }
+        vector<size_t> args;
+        for (auto& input : node->inputs())
+        {
+            if (input.get_is_relevant_to_values())
+            {
+                args.push_back(instruction_index.at(input.get_source_output().get_node()));
+            }
+        }
+        if (!add_instruction(node.get(), args))
+        {
+            NGRAPH_DEBUG << "Shape program: unsupported determinant " << node->get_name();
+            m_valid = false;
+            return;
+        }
+        instruction_index[node.get()] = m_instructions.size() - 1;
+
+        bool is_output = false;
+        for (auto& input : node->output(0).get_target_inputs())
+        {
+            is_output = is_output || input.get_is_relevant_to_shapes();
+        }
+        if (is_output)
+        {
+            m_outputs.push_back(m_instructions.size() - 1);
+        }
+    }
+}
+
+bool runtime::dynamic::ShapeProgram::add_instruction(Node* node, const vector<size_t>& args)
+{
+    if (node->get_output_size() != 1 || !node->get_output_element_type(0).is_integral())
+    {
+        return false;
+    }
+
+    Instruction instruction{Opcode::Constant, args, 0, {}};
+    if (auto constant = as_type<op::v0::Constant>(node))
+    {
+        instruction.constant = {constant->get_output_shape(0),
+                                constant->cast_vector<int64_t>()};
+    }
+    else if (node->is_parameter())
+    {
+        auto it = find(m_parameters.begin(), m_parameters.end(), node);
+        if (it == m_parameters.end())
+        {
+            return false;
+        }
+        instruction.opcode = Opcode::Parameter;
+        instruction.attribute = it - m_parameters.begin();
+    }
+    else if (is_type<op::v0::ShapeOf>(node) || is_type<op::v3::ShapeOf>(node))
+    {
+        auto source = node->get_input_node_ptr(0);
+        auto it = find(m_parameters.begin(), m_parameters.end(), source);
+        if (it != m_parameters.end())
+        {
+            instruction.opcode = Opcode::ParameterShape;
+            instruction.attribute = it - m_parameters.begin();
+        }
+        else if (node->get_input_partial_shape(0).is_static())
+        {
+            const Shape& shape = node->get_input_shape(0);
+            instruction.constant = {Shape{shape.size()},
+                                    vector<int64_t>(shape.begin(), shape.end())};
+        }
+        else
+        {
+            // The shape of an intermediate value needs shape inference of the whole graph
+            return false;
+        }
+    }
+    else if (is_type<op::v0::Convert>(node))
+    {
+        instruction.opcode = Opcode::Convert;
+    }
+    else if (auto gather = as_type<op::v0::Gather>(node))
+    {
+        instruction.opcode = Opcode::Gather;
+        instruction.attribute = gather->get_axis();
+    }
+    else if (auto gather = as_type<op::v1::Gather>(node))
+    {
+        if (gather->get_axis() == op::v1::Gather::AXIS_NOT_SET_VALUE)
+        {
+            return false;
+        }
+        instruction.opcode = Opcode::Gather;
+        instruction.attribute = gather->get_axis();
+        // The axis input is read once here
+        instruction.args.resize(2);
+    }
+    else if (auto concat = as_type<op::v0::Concat>(node))
+    {
+        instruction.opcode = Opcode::Concat;
+        instruction.attribute = concat->get_concatenation_axis();
+    }
+    else if (is_type<op::v0::Range>(node))
+    {
+        instruction.opcode = Opcode::Range;
+    }
+    else if (auto reshape = as_type<op::v1::Reshape>(node))
+    {
+        instruction.opcode = Opcode::Reshape;
+        instruction.attribute = reshape->get_special_zero();
+    }
+    else if (is_type<op::v1::Add>(node))
+    {
+        instruction.opcode = Opcode::Add;
+    }
+    else if (is_type<op::v1::Subtract>(node))
+    {
+        instruction.opcode = Opcode::Subtract;
+    }
+    else if (is_type<op::v1::Multiply>(node))
+    {
+        instruction.opcode = Opcode::Multiply;
+    }
+    else if (auto divide = as_type<op::v1::Divide>(node))
+    {
+        instruction.opcode = divide->is_pythondiv() ? Opcode::FloorDivide : Opcode::Divide;
+    }
+    else if (is_type<op::v1::Maximum>(node))
+    {
+        instruction.opcode = Opcode::Maximum;
+    }
+    else if (is_type<op::v1::Minimum>(node))
+    {
+        instruction.opcode = Opcode::Minimum;
+    }
+    else
+    {
+        return false;
+    }
+    m_instructions.push_back(instruction);
+    return true;
+}
+
+bool runtime::dynamic::ShapeProgram::execute(const Instruction& instruction,
+                                             const vector<Value>& values,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                             Value& result) const
+{
+    switch (instruction.opcode)
+    {
+    case Opcode::Constant: result = instruction.constant; return true;
+    case Opcode::Parameter:
+    {
+        auto& tensor = *inputs.at(instruction.attribute);
+        result.shape = tensor.get_shape();
+        result.data = read_values(tensor);
+        return true;
+    }
+    case Opcode::ParameterShape:
+    {
+        const Shape& shape = inputs.at(instruction.attribute)->get_shape();
+        result.shape = Shape{shape.size()};
+        result.data.assign(shape.begin(), shape.end());
+        return true;
+    }
+    case Opcode::Convert: result = values[instruction.args[0]]; return true;
+    case Opcode::Gather:
+    {
+        // Shapes are vectors, so only gathers from a vector are supported
+        const Value& data = values[instruction.args[0]];
+        const Value& indices = values[instruction.args[1]];
+        if (data.shape.size() != 1 || (instruction.attribute != 0 && instruction.attribute != -1))
+        {
+            return false;
+        }
+        const int64_t size = data.data.size();
+        result.shape = indices.shape;
+        result.data.clear();
+        for (int64_t index : indices.data)
+        {
+            index = index < 0 ? index + size : index;
+            if (index < 0 || index >= size)
+            {
+                return false;
+            }
+            result.data.push_back(data.data[index]);
+        }
+        return true;
+    }
+    case Opcode::Concat:
+    {
+        if (instruction.attribute != 0 && instruction.attribute != -1)
+        {
+            return false;
+        }
+        result.data.clear();
+        for (size_t arg : instruction.args)
+        {
+            const Value& value = values[arg];
+            if (value.shape.size() != 1)
+            {
+                return false;
+            }
+            result.data.insert(result.data.end(), value.data.begin(), value.data.end());
+        }
+        result.shape = Shape{result.data.size()};
+        return true;
+    }
+    case Opcode::Range:
+    {
+        const Value& start = values[instruction.args[0]];
+        const Value& stop = values[instruction.args[1]];
+        const Value& step = values[instruction.args[2]];
+        if (start.data.size() != 1 || stop.data.size() != 1 || step.data.size() != 1 ||
+            step.data[0] == 0)
+        {
+            return false;
+        }
+        result.data.clear();
+        for (int64_t v = start.data[0];
+             step.data[0] > 0 ? v < stop.data[0] : v > stop.data[0];
+             v += step.data[0])
+        {
+            result.data.push_back(v);
+        }
+        result.shape = Shape{result.data.size()};
+        return true;
+    }
+    case Opcode::Reshape:
+    {
+        const Value& data = values[instruction.args[0]];
+        const Value& pattern = values[instruction.args[1]];
+        result.shape.clear();
+        size_t known = 1;
+        size_t inferred = pattern.data.size();
+        for (size_t i = 0; i < pattern.data.size(); i++)
+        {
+            int64_t dim = pattern.data[i];
+            if (dim == 0 && instruction.attribute)
+            {
+                if (i >= data.shape.size())
+                {
+                    return false;
+                }
+                dim = data.shape[i];
+            }
+            else if (dim == -1 && inferred == pattern.data.size())
+            {
+                inferred = i;
+                dim = 1;
+            }
+            else if (dim < 0)
+            {
+                return false;
+            }
+            result.shape.push_back(dim);
+            known *= dim;
+        }
+        if (inferred != pattern.data.size())
+        {
+            if (known == 0 || data.data.size() % known != 0)
+            {
+                return false;
+            }
+            result.shape[inferred] = data.data.size() / known;
+        }
+        else if (known != data.data.size())
+        {
+            return false;
+        }
+        result.data = data.data;
+        return true;
+    }
+    case Opcode::Add:
+    case Opcode::Subtract:
+    case Opcode::Multiply:
+    case Opcode::Divide:
+    case Opcode::FloorDivide:
+    case Opcode::Maximum:
+    case Opcode::Minimum: break;
+    }
+
+    // Elementwise ops, with a single element broadcast to the shape of the other side
+    const Value& a = values[instruction.args[0]];
+    const Value& b = values[instruction.args[1]];
+    const size_t a_size = a.data.size();
+    const size_t b_size = b.data.size();
+    if (a.shape != b.shape && a_size != 1 && b_size != 1)
+    {
+        return false;
+    }
+    if (a.shape == b.shape || (b_size == 1 && (a_size != 1 || a.shape.size() >= b.shape.size())))
+    {
+        result.shape = a.shape;
+    }
+    else
+    {
+        result.shape = b.shape;
+    }
+    const size_t size = max(a_size, b_size);
+    result.data.resize(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        int64_t x = a.data[a_size == 1 ? 0 : i];
+        int64_t y = b.data[b_size == 1 ? 0 : i];
+        int64_t z = 0;
+        switch (instruction.opcode)
+        {
+        case Opcode::Add: z = x + y; break;
+        case Opcode::Subtract: z = x - y; break;
+        case Opcode::Multiply: z = x * y; break;
+        case Opcode::Divide:
+        case Opcode::FloorDivide:
+            if (y == 0)
+            {
+                return false;
+            }
+            z = x / y;
+            if (instruction.opcode == Opcode::FloorDivide && (x % y != 0) && ((x < 0) != (y < 0)))
+            {
+                z--;
+            }
+            break;
+        case Opcode::Maximum: z = max(x, y); break;
+        case Opcode::Minimum: z = min(x, y); break;
+        default: return false;
+        }
+        result.data[i] = z;
+    }
+    return true;
+}
+
+bool runtime::dynamic::ShapeProgram::evaluate(const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                              vector<int64_t>& key) const
+{
+    if (!m_valid || inputs.size() != m_parameters.size())
+    {
+        return false;
+    }
+
+    vector<Value> values(m_instructions.size());
+    for (size_t i = 0; i < m_instructions.size(); i++)
+    {
+        if (!execute(m_instructions[i], values, inputs, values[i]))
+        {
+            return false;
+        }
+    }
+
+    for (size_t output : m_outputs)
+    {
+        const Value& value = values[output];
+        key.push_back(value.shape.size());
+        key.insert(key.end(), value.shape.begin(), value.shape.end());
+        key.insert(key.end(), value.data.begin(), value.data.end());
+    }
+    return true;
+}
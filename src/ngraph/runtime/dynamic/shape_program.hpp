@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace dynamic
+        {
+            class ShapeProgram;
+        }
+    }
+}
+
+///
+/// \brief The part of a function that computes the values of its shape-relevant inputs,
+///        extracted into a small integer interpreter that runs on the host.
+///
+/// The program consists of the shape determinants found by `pass::ShapeRelevance`: the nodes
+/// whose values reach a shape-relevant input, such as the shape input of `v1::Reshape`.
+/// Typically these are `ShapeOf`, `Gather`, `Concat`, `Range` and integer arithmetic over
+/// parameter shapes and shape-relevant parameters. Evaluating the program yields the values
+/// that `DynamicExecutable` would otherwise have to specialize and constant fold the whole
+/// function to find.
+///
+/// A program is only usable if every determinant is one of the supported ops and no
+/// determinant feeds a value-relevant input other than a shape-relevant one. Otherwise the
+/// values of shape-relevant parameters may affect more than the shapes, and calls must be told
+/// apart by those values instead.
+///
+class ngraph::runtime::dynamic::ShapeProgram
+{
+public:
+    /// \brief Extracts the program of f. The parameters of f must have been flagged by
+    ///        pass::ShapeRelevance.
+    ShapeProgram(const std::shared_ptr<Function>& f);
+
+    /// \return true if the program can stand in for the values of the shape-relevant
+    ///         parameters of the function.
+    bool is_valid() const { return m_valid; }
+    /// \brief Runs the program on the function inputs and appends, for each shape-relevant
+    ///        input of the function, the rank, the dimensions and the elements of its value to
+    ///        key.
+    /// \return false, leaving key untouched, if the program is not valid or the inputs are
+    ///         out of its range (e.g. a gather index out of bounds).
+    bool evaluate(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                  std::vector<int64_t>& key) const;
+
+private:
+    enum class Opcode
+    {
+        Constant,
+        Parameter,
+        ParameterShape,
+        Convert,
+        Gather,
+        Concat,
+        Range,
+        Reshape,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        FloorDivide,
+        Maximum,
+        Minimum
+    };
+
+    struct Value
+    {
+        Shape shape;
+        std::vector<int64_t> data;
+    };
+
+    struct Instruction
+    {
+        Opcode opcode;
+        // Indices of the values read, which are the results of earlier instructions
+        std::vector<size_t> args;
+        // Parameter index for Parameter and ParameterShape, the axis for Gather and Concat,
+        // special_zero for Reshape
+        int64_t attribute;
+        // Result of Constant
+        Value constant;
+    };
+
+    bool add_instruction(Node* node, const std::vector<size_t>& args);
+    bool execute(const Instruction& instruction,
+                 const std::vector<Value>& values,
+                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                 Value& result) const;
+
+    bool m_valid;
+    std::vector<Instruction> m_instructions;
+    // Instructions whose results reach shape-relevant inputs
+    std::vector<size_t> m_outputs;
+    std::vector<Node*> m_parameters;
+};
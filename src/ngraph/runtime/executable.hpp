@@ -73,6 +73,10 @@ public:
     /// \returns  preferred pipeline_depth
     virtual size_t get_preferred_pipeline_depth() const;
 
+    /// \brief Reset state kept across calls, such as attention key/value caches, e.g. before
+    ///     decoding a new sequence. Must not overlap with a call. Does nothing by default.
+    virtual void reset_state();
+
     /// \brief Save this compiled Executable to an output stream.
     ///    Saved stream may be read with Backend::load
     virtual void save(std::ostream& output_stream);
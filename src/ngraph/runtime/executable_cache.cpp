@@ -42,15 +42,16 @@ runtime::ExecutableCache::ExecutableCache()
 
 runtime::ExecutableCache::~ExecutableCache() {}
 
-void runtime::ExecutableCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
+void runtime::ExecutableCache::convert_shape_to_string(const vector<int64_t>& shape,
+                                                       ostringstream& key)
 {
     if (!shape.empty())
     {
-        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int>(key, ", "));
+        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int64_t>(key, ", "));
     }
 }
 
-void runtime::ExecutableCache::add_entry(const vector<int>& shape,
+void runtime::ExecutableCache::add_entry(const vector<int64_t>& shape,
                                          shared_ptr<runtime::Executable> exec,
                                          shared_ptr<Function> func)
 {
@@ -72,7 +73,7 @@ void runtime::ExecutableCache::add_entry(const vector<int>& shape,
     m_clone_function_map.insert({key.str(), func});
 }
 
-bool runtime::ExecutableCache::is_cached(const vector<int>& shape)
+bool runtime::ExecutableCache::is_cached(const vector<int64_t>& shape)
 {
     for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
     {
@@ -84,7 +85,8 @@ bool runtime::ExecutableCache::is_cached(const vector<int>& shape)
     return false;
 }
 
-shared_ptr<runtime::Executable> runtime::ExecutableCache::get_cached_entry(const vector<int>& shape)
+shared_ptr<runtime::Executable>
+    runtime::ExecutableCache::get_cached_entry(const vector<int64_t>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
     ostringstream key;
@@ -114,7 +116,7 @@ shared_ptr<runtime::Executable> runtime::ExecutableCache::get_cached_entry(const
 
 // Need the clone function to get the output shape so that
 // storage can be allocated for output
-shared_ptr<Function> runtime::ExecutableCache::get_cloned_function(const vector<int>& shape)
+shared_ptr<Function> runtime::ExecutableCache::get_cloned_function(const vector<int64_t>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
     ostringstream key;
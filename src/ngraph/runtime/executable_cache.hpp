@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -44,18 +45,18 @@ public:
 
     virtual ~ExecutableCache();
 
-    void add_entry(const std::vector<int>& shape,
+    void add_entry(const std::vector<int64_t>& shape,
                    std::shared_ptr<Executable> exec,
                    std::shared_ptr<Function> func);
-    bool is_cached(const std::vector<int>& shape);
-    std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
-    void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
-    std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
+    bool is_cached(const std::vector<int64_t>& shape);
+    std::shared_ptr<Executable> get_cached_entry(const std::vector<int64_t>& shape);
+    void convert_shape_to_string(const std::vector<int64_t>& shape, std::ostringstream& key);
+    std::shared_ptr<Function> get_cloned_function(const std::vector<int64_t>& shape);
 
 private:
     size_t m_cache_size;
     GraphCache m_map;
     ClonedFunctionMap m_clone_function_map;
-    std::list<std::vector<int>> m_list;
+    std::list<std::vector<int64_t>> m_list;
     std::mutex m_mutex;
 };
@@ -0,0 +1,231 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The file is line based:
+//   ngraph_execution_profile 1
+//   calls <call count>
+//   inputs <count> <change count>...
+//   op <type> <call count> <total microseconds> <serial> <output count> (<rank> <dims>...)...
+static const char* s_profile_magic = "ngraph_execution_profile";
+static const int s_profile_version = 1;
+
+namespace
+{
+    // FNV-1a, so that the hash of a saved profile does not depend on the build that reads it
+    class FunctionHash
+    {
+    public:
+        void add(const string& value)
+        {
+            for (char c : value)
+            {
+                add_byte(static_cast<uint8_t>(c));
+            }
+            add_byte(0);
+        }
+        void add(uint64_t value)
+        {
+            for (size_t i = 0; i < sizeof(value); i++)
+            {
+                add_byte(static_cast<uint8_t>(value >> (8 * i)));
+            }
+        }
+        void add(const Shape& shape)
+        {
+            add(static_cast<uint64_t>(shape.size()));
+            for (auto dim : shape)
+            {
+                add(static_cast<uint64_t>(dim));
+            }
+        }
+        size_t get() const { return static_cast<size_t>(m_hash); }
+    private:
+        void add_byte(uint8_t byte) { m_hash = (m_hash ^ byte) * 1099511628211ULL; }
+        uint64_t m_hash = 14695981039346656037ULL;
+    };
+}
+
+runtime::ExecutionProfile::ExecutionProfile(const vector<PerformanceCounter>& counters)
+{
+    for (auto& counter : counters)
+    {
+        auto node = counter.get_node();
+        Op op;
+        op.type = node->description();
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            op.output_shapes.push_back(node->get_output_shape(i));
+        }
+        op.call_count = counter.call_count();
+        op.total_microseconds = counter.total_microseconds();
+        op.serial = counter.is_serial();
+        m_ops.push_back(op);
+        m_call_count = max(m_call_count, op.call_count);
+    }
+}
+
+const runtime::ExecutionProfile::Op* runtime::ExecutionProfile::find(size_t index,
+                                                                     const Node& node) const
+{
+    if (index >= m_ops.size() || m_ops[index].type != node.description() ||
+        m_ops[index].output_shapes.size() != node.get_output_size())
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        if (node.get_output_partial_shape(i).is_dynamic() ||
+            m_ops[index].output_shapes[i] != node.get_output_shape(i))
+        {
+            return nullptr;
+        }
+    }
+    return &m_ops[index];
+}
+
+size_t runtime::ExecutionProfile::get_function_hash() const
+{
+    FunctionHash hash;
+    for (auto& op : m_ops)
+    {
+        hash.add(op.type);
+        hash.add(static_cast<uint64_t>(op.output_shapes.size()));
+        for (auto& shape : op.output_shapes)
+        {
+            hash.add(shape);
+        }
+    }
+    return hash.get();
+}
+
+size_t runtime::ExecutionProfile::get_function_hash(const NodeVector& ops)
+{
+    FunctionHash hash;
+    for (auto& node : ops)
+    {
+        hash.add(node->description());
+        hash.add(static_cast<uint64_t>(node->get_output_size()));
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            if (node->get_output_partial_shape(i).is_dynamic())
+            {
+                // No recorded shape has this rank, so a dynamic function never matches
+                hash.add(numeric_limits<uint64_t>::max());
+            }
+            else
+            {
+                hash.add(node->get_output_shape(i));
+            }
+        }
+    }
+    return hash.get();
+}
+
+void runtime::ExecutionProfile::save(const string& path) const
+{
+    ofstream out(path);
+    if (!out)
+    {
+        throw ngraph_error("Unable to write execution profile '" + path + "'");
+    }
+    out << s_profile_magic << " " << s_profile_version << "\n";
+    out << "calls " << m_call_count << "\n";
+    out << "inputs " << m_input_change_counts.size();
+    for (auto count : m_input_change_counts)
+    {
+        out << " " << count;
+    }
+    out << "\n";
+    for (auto& op : m_ops)
+    {
+        out << "op " << op.type << " " << op.call_count << " " << op.total_microseconds << " "
+            << op.serial << " " << op.output_shapes.size();
+        for (auto& shape : op.output_shapes)
+        {
+            out << " " << shape.size();
+            for (auto dim : shape)
+            {
+                out << " " << dim;
+            }
+        }
+        out << "\n";
+    }
+}
+
+runtime::ExecutionProfile runtime::ExecutionProfile::load(const string& path)
+{
+    ifstream in(path);
+    if (!in)
+    {
+        throw ngraph_error("Unable to read execution profile '" + path + "'");
+    }
+    auto expect = [&](bool condition) {
+        if (!condition)
+        {
+            throw ngraph_error("Malformed execution profile '" + path + "'");
+        }
+    };
+
+    ExecutionProfile profile;
+    string tag;
+    int version = 0;
+    in >> tag >> version;
+    expect(in && tag == s_profile_magic && version == s_profile_version);
+    in >> tag >> profile.m_call_count;
+    expect(in && tag == "calls");
+    size_t input_count = 0;
+    in >> tag >> input_count;
+    expect(in && tag == "inputs");
+    profile.m_input_change_counts.resize(input_count);
+    for (auto& count : profile.m_input_change_counts)
+    {
+        in >> count;
+    }
+    expect(static_cast<bool>(in));
+
+    while (in >> tag)
+    {
+        expect(tag == "op");
+        Op op;
+        size_t output_count = 0;
+        in >> op.type >> op.call_count >> op.total_microseconds >> op.serial >> output_count;
+        for (size_t i = 0; in && i < output_count; i++)
+        {
+            size_t rank = 0;
+            in >> rank;
+            Shape shape(rank);
+            for (auto& dim : shape)
+            {
+                in >> dim;
+            }
+            op.output_shapes.push_back(shape);
+        }
+        expect(static_cast<bool>(in));
+        profile.m_ops.push_back(op);
+    }
+    return profile;
+}
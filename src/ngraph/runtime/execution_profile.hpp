@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ExecutionProfile;
+    }
+}
+
+/// \brief What an executable saw over real calls: per-op times and shapes, how often each op
+///        actually ran, and how often each input changed. Saved to a file and fed back when the
+///        function is compiled again, so that backends can base compile-time choices on it.
+///
+/// Ops are recorded in the order of the performance counters of the executable. The function
+/// hash covers the type and output shapes of every op in that order, so a backend applies a
+/// profile only to a function whose compiled ops hash the same. The profile of another
+/// function, or of one compiled with other passes, is ignored rather than misapplied.
+class NGRAPH_API ngraph::runtime::ExecutionProfile
+{
+public:
+    struct Op
+    {
+        std::string type;
+        std::vector<Shape> output_shapes;
+        size_t call_count;
+        size_t total_microseconds;
+        // Whether the op ran on the calling thread rather than on the thread pool
+        bool serial;
+
+        size_t microseconds() const
+        {
+            return call_count == 0 ? 0 : total_microseconds / call_count;
+        }
+    };
+
+    ExecutionProfile() = default;
+    /// \brief Profile of the ops behind counters. The call count is the largest op call count.
+    explicit ExecutionProfile(const std::vector<PerformanceCounter>& counters);
+
+    /// Number of calls of the executable. Ops whose inputs are cached may run in fewer.
+    size_t get_call_count() const { return m_call_count; }
+    void set_call_count(size_t call_count) { m_call_count = call_count; }
+    const std::vector<Op>& get_ops() const { return m_ops; }
+    /// Number of calls in which each input held new data. Empty if the backend does not track
+    /// input changes.
+    const std::vector<size_t>& get_input_change_counts() const { return m_input_change_counts; }
+    void set_input_change_counts(const std::vector<size_t>& counts)
+    {
+        m_input_change_counts = counts;
+    }
+
+    /// \return The record of the op at position index if it was recorded for an op like node,
+    ///         else nullptr
+    const Op* find(size_t index, const Node& node) const;
+
+    /// \brief Hash of the recorded op types and output shapes. Stable across runs and builds.
+    size_t get_function_hash() const;
+    /// \return The function hash a profile recorded for ops, in this order, would have
+    static size_t get_function_hash(const NodeVector& ops);
+
+    void save(const std::string& path) const;
+    static ExecutionProfile load(const std::string& path);
+
+private:
+    size_t m_call_count = 0;
+    std::vector<Op> m_ops;
+    std::vector<size_t> m_input_change_counts;
+};
@@ -117,6 +117,8 @@ void runtime::HostTensor::initialize(const std::shared_ptr<op::v0::Constant>& co
 
 runtime::HostTensor::~HostTensor()
 {
+    // A staged write may still target this buffer
+    wait_for_pending_write_nothrow();
     if (m_allocated_buffer_pool != nullptr)
     {
         ngraph_free(m_allocated_buffer_pool);
@@ -147,6 +149,7 @@ const void* runtime::HostTensor::get_data_ptr() const
 void runtime::HostTensor::write(const void* source, size_t n)
 {
     event::Duration d1("write", "HostTensor");
+    wait_for_pending_write();
     void* target = get_data_ptr();
     if (n != m_buffer_size)
     {
@@ -165,6 +168,7 @@ void runtime::HostTensor::write(const void* source, size_t n)
 void runtime::HostTensor::read(void* target, size_t n) const
 {
     event::Duration d1("read", "HostTensor");
+    wait_for_pending_write();
     const void* source = get_data_ptr();
     if (n != m_buffer_size)
     {
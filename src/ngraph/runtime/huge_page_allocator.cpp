@@ -0,0 +1,245 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::HugePageAllocator::huge_page_size;
+
+runtime::HugePageAllocator::HugePageAllocator(Mode mode, bool prefault, size_t recycle_limit)
+    : m_mode(mode)
+    , m_prefault(prefault)
+    , m_recycle_limit(recycle_limit)
+{
+}
+
+runtime::HugePageAllocator::~HugePageAllocator()
+{
+    for (auto& p : m_recycled)
+    {
+        unmap(p.second);
+    }
+    // Anything still live belongs to a buffer that outlived its allocator; leave it mapped
+}
+
+void* runtime::HugePageAllocator::malloc(size_t size, size_t /* alignment */)
+{
+#ifdef __linux__
+    if (size >= huge_page_size)
+    {
+        // Mappings are huge page aligned, which covers every alignment AlignedBuffer asks for
+        size_t rounded_size = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+        lock_guard<mutex> lock(m_mutex);
+
+        // Reuse a recycled mapping unless it would waste more than the request itself
+        auto it = m_recycled.lower_bound(rounded_size);
+        Mapping mapping;
+        if (it != m_recycled.end() && it->first <= 2 * rounded_size)
+        {
+            mapping = it->second;
+            m_recycled_size -= mapping.size;
+            m_recycled.erase(it);
+        }
+        else
+        {
+            mapping = map(rounded_size);
+        }
+        m_mapped[mapping.ptr] = mapping;
+        return mapping.ptr;
+    }
+#endif
+    void* ptr = std::malloc(size);
+    if (!ptr)
+    {
+        throw ngraph_error("malloc failed to allocate memory of size " + to_string(size));
+    }
+    return ptr;
+}
+
+void runtime::HugePageAllocator::free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_mapped.find(ptr);
+        if (it != m_mapped.end())
+        {
+            Mapping mapping = it->second;
+            m_mapped.erase(it);
+            if (m_recycled_size + mapping.size <= m_recycle_limit)
+            {
+                m_recycled.emplace(mapping.size, mapping);
+                m_recycled_size += mapping.size;
+            }
+            else
+            {
+                unmap(mapping);
+            }
+            return;
+        }
+    }
+    std::free(ptr);
+}
+
+bool runtime::HugePageAllocator::is_aligned(size_t size, size_t alignment) const
+{
+#ifdef __linux__
+    // Mappings start on a huge page boundary
+    return size >= huge_page_size && alignment != 0 && huge_page_size % alignment == 0;
+#else
+    (void)size;
+    (void)alignment;
+    return false;
+#endif
+}
+
+size_t runtime::HugePageAllocator::get_recycled_size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_recycled_size;
+}
+
+runtime::HugePageAllocator::Mapping runtime::HugePageAllocator::map(size_t size)
+{
+#ifdef __linux__
+    Mapping mapping{MAP_FAILED, size};
+    if (m_mode == Mode::EXPLICIT)
+    {
+        // hugetlbfs mappings always start on a huge page boundary
+        mapping.ptr = mmap(nullptr,
+                           size,
+                           PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                           -1,
+                           0);
+        if (mapping.ptr == MAP_FAILED)
+        {
+            NGRAPH_DEBUG << "No reserved huge pages for " << size
+                         << " bytes, falling back to transparent huge pages";
+        }
+    }
+    if (mapping.ptr == MAP_FAILED)
+    {
+        // Anonymous mappings are only page aligned, and THP can only back huge page aligned
+        // ranges. Map one extra huge page, then unmap the head and tail around an aligned
+        // range so that only `size` bytes stay mapped.
+        size_t length = size + huge_page_size;
+        void* base =
+            mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+        {
+            throw ngraph_error("mmap failed to allocate memory of size " + to_string(size));
+        }
+        char* begin = static_cast<char*>(base);
+        size_t head = (huge_page_size - reinterpret_cast<size_t>(begin) % huge_page_size) %
+                      huge_page_size;
+        if (head > 0)
+        {
+            munmap(begin, head);
+        }
+        munmap(begin + head + size, length - head - size);
+        mapping.ptr = begin + head;
+#ifdef MADV_HUGEPAGE
+        // Only a hint; kernels built without THP ignore it. It must precede the first touch,
+        // otherwise the range is already backed by small pages.
+        madvise(mapping.ptr, size, MADV_HUGEPAGE);
+#endif
+    }
+    if (m_prefault)
+    {
+        prefault(mapping.ptr, size);
+    }
+    return mapping;
+#else
+    throw ngraph_error("Huge page mappings are not supported on this platform");
+#endif
+}
+
+void runtime::HugePageAllocator::prefault(void* ptr, size_t size)
+{
+#ifdef __linux__
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(ptr, size, MADV_POPULATE_WRITE) == 0)
+    {
+        return;
+    }
+#endif
+    // Kernels before 5.14 lack MADV_POPULATE_WRITE; a write per huge page faults it in
+    volatile char* data = static_cast<char*>(ptr);
+    for (size_t offset = 0; offset < size; offset += huge_page_size)
+    {
+        data[offset] = 0;
+    }
+#else
+    (void)ptr;
+    (void)size;
+#endif
+}
+
+void runtime::HugePageAllocator::unmap(const Mapping& mapping)
+{
+#ifdef __linux__
+    munmap(mapping.ptr, mapping.size);
+#else
+    (void)mapping;
+#endif
+}
+
+runtime::Allocator* runtime::get_huge_page_allocator_from_env()
+{
+    static Allocator* allocator = []() -> Allocator* {
+        string mode = getenv_string("NGRAPH_HUGE_PAGES");
+        if (mode.empty() || mode == "0")
+        {
+            return nullptr;
+        }
+        HugePageAllocator::Mode hp_mode;
+        if (mode == "explicit")
+        {
+            hp_mode = HugePageAllocator::Mode::EXPLICIT;
+        }
+        else if (mode == "1" || mode == "transparent")
+        {
+            hp_mode = HugePageAllocator::Mode::TRANSPARENT;
+        }
+        else
+        {
+            throw ngraph_error("Unexpected value specified for NGRAPH_HUGE_PAGES (" + mode +
+                               "). Please specify one of 0, 1, transparent or explicit");
+        }
+        int32_t recycle_mb = getenv_int("NGRAPH_HUGE_PAGES_RECYCLE_MB", 0);
+        size_t recycle_limit = recycle_mb > 0 ? size_t(recycle_mb) * 1024 * 1024 : 0;
+        // Never destroyed: buffers freed during static destruction still need it
+        return new HugePageAllocator(
+            hp_mode, getenv_bool("NGRAPH_HUGE_PAGES_PREFAULT"), recycle_limit);
+    }();
+    return allocator;
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HugePageAllocator;
+
+        /// \brief Returns the huge page allocator configured through NGRAPH_HUGE_PAGES,
+        ///        NGRAPH_HUGE_PAGES_PREFAULT and NGRAPH_HUGE_PAGES_RECYCLE_MB, or nullptr if
+        ///        NGRAPH_HUGE_PAGES is not set.
+        NGRAPH_API
+        ngraph::runtime::Allocator* get_huge_page_allocator_from_env();
+    }
+}
+
+/// \brief Allocator that backs large allocations with huge pages.
+///
+/// Allocations of at least `huge_page_size` bytes are mapped directly with mmap, either from
+/// the reserved hugetlbfs pool (MAP_HUGETLB) or as anonymous memory marked for transparent
+/// huge pages. Explicit mappings fall back to transparent huge pages when no reserved pages
+/// are available. Either way the returned pointer is huge page aligned. Smaller allocations
+/// and platforms without mmap use the system allocator.
+class NGRAPH_API ngraph::runtime::HugePageAllocator : public ngraph::runtime::Allocator
+{
+public:
+    enum class Mode
+    {
+        TRANSPARENT,
+        EXPLICIT
+    };
+
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    /// \param mode whether to request reserved huge pages or transparent huge pages
+    /// \param prefault populate each mapping after it is marked for huge pages, so the
+    ///                 first pass over a pool neither takes page faults nor gets small pages
+    /// \param recycle_limit number of bytes of freed mappings kept for reuse by later
+    ///                      allocations of a similar size; 0 disables recycling
+    HugePageAllocator(Mode mode = Mode::TRANSPARENT,
+                      bool prefault = false,
+                      size_t recycle_limit = 0);
+    ~HugePageAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+    bool is_aligned(size_t size, size_t alignment) const override;
+
+    /// \brief Number of bytes of freed mappings currently kept for reuse
+    size_t get_recycled_size();
+
+private:
+    HugePageAllocator(const HugePageAllocator&) = delete;
+    HugePageAllocator& operator=(const HugePageAllocator&) = delete;
+
+    struct Mapping
+    {
+        // Huge page aligned pointer handed out and the mapped bytes behind it
+        void* ptr;
+        size_t size;
+    };
+
+    Mapping map(size_t size);
+    void unmap(const Mapping& mapping);
+    void prefault(void* ptr, size_t size);
+
+    Mode m_mode;
+    bool m_prefault;
+    size_t m_recycle_limit;
+    size_t m_recycled_size = 0;
+    std::mutex m_mutex;
+    // Live mappings keyed by the pointer handed out
+    std::unordered_map<void*, Mapping> m_mapped;
+    // Freed mappings kept for reuse, keyed by usable size
+    std::multimap<size_t, Mapping> m_recycled;
+};
@@ -125,6 +125,7 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     vector<shared_ptr<HostTensor>> func_inputs;
     for (auto tensor : inputs)
     {
+        tensor->wait_for_read_ready();
         auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
         func_inputs.push_back(host_tensor);
     }
@@ -137,6 +138,7 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
     vector<shared_ptr<HostTensor>> func_outputs;
     for (auto tensor : outputs)
     {
+        tensor->wait_for_write_ready();
         auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
         func_outputs.push_back(host_tensor);
     }
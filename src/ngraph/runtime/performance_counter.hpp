@@ -41,9 +41,20 @@ namespace ngraph
                 return m_call_count == 0 ? 0 : m_total_microseconds / m_call_count;
             }
             size_t call_count() const { return m_call_count; }
+            /// Work the backend estimated for the node, in bytes touched
+            size_t work_estimate() const { return m_work_estimate; }
+            /// Work below which the backend runs a node on the calling thread rather than on
+            /// its thread pool. 0 when the backend does not make that choice.
+            size_t parallel_threshold() const { return m_parallel_threshold; }
+            /// Whether the node runs on the calling thread. Usually the work estimate is below
+            /// the threshold, unless an execution profile showed otherwise.
+            bool is_serial() const { return m_serial; }
             std::shared_ptr<const Node> m_node;
             size_t m_total_microseconds;
             size_t m_call_count;
+            size_t m_work_estimate = 0;
+            size_t m_parallel_threshold = 0;
+            bool m_serial = false;
         };
     }
 }
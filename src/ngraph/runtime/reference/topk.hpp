@@ -69,6 +69,7 @@ namespace ngraph
                 return std::get<1>(a) > std::get<1>(b);
             }
 
+            // Either out_indices or out_values may be null when that output is not needed
             template <typename T, typename U>
             void topk(const T* arg,
                       U* out_indices,
@@ -164,8 +165,14 @@ namespace ngraph
                     for (size_t j = 0; j < k; j++)
                     {
                         tuple<T, U> entry = workspace[j];
-                        out_values[out_index] = get<0>(entry);
-                        out_indices[out_index] = get<1>(entry);
+                        if (out_values)
+                        {
+                            out_values[out_index] = get<0>(entry);
+                        }
+                        if (out_indices)
+                        {
+                            out_indices[out_index] = get<1>(entry);
+                        }
                         out_index += out_axis_stride;
                     }
                 }
@@ -14,6 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
@@ -23,6 +30,75 @@
 using namespace ngraph;
 using namespace std;
 
+namespace
+{
+    // Single background thread that performs staged tensor writes in submission order.
+    // One thread is enough to overlap host copies with compute; more would only compete
+    // with the compute threads for memory bandwidth.
+    class StagingQueue
+    {
+    public:
+        static StagingQueue& get()
+        {
+            static StagingQueue s_queue;
+            return s_queue;
+        }
+
+        shared_future<void> enqueue(function<void()> copy)
+        {
+            packaged_task<void()> task(move(copy));
+            shared_future<void> done = task.get_future().share();
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_tasks.push_back(move(task));
+            }
+            m_cv.notify_one();
+            return done;
+        }
+
+    private:
+        StagingQueue()
+            : m_thread([this]() { run(); })
+        {
+        }
+
+        ~StagingQueue()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_shutdown = true;
+            }
+            m_cv.notify_one();
+            m_thread.join();
+        }
+
+        void run()
+        {
+            while (true)
+            {
+                packaged_task<void()> task;
+                {
+                    unique_lock<mutex> lock(m_mutex);
+                    m_cv.wait(lock, [this]() { return m_shutdown || !m_tasks.empty(); });
+                    if (m_tasks.empty())
+                    {
+                        return;
+                    }
+                    task = move(m_tasks.front());
+                    m_tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        mutex m_mutex;
+        condition_variable m_cv;
+        deque<packaged_task<void()>> m_tasks;
+        bool m_shutdown = false;
+        thread m_thread;
+    };
+}
+
 const Shape& runtime::Tensor::get_shape() const
 {
     return m_descriptor->get_shape();
@@ -73,6 +149,20 @@ const std::string& runtime::Tensor::get_name() const
     return m_descriptor->get_name();
 }
 
+runtime::Tensor::~Tensor()
+{
+    wait_for_pending_write_nothrow();
+}
+
+runtime::Tensor& runtime::Tensor::operator=(const Tensor& other)
+{
+    m_descriptor = other.m_descriptor;
+    m_stale = other.m_stale;
+    m_version = other.m_version;
+    m_original_partial_shape = other.m_original_partial_shape;
+    return *this;
+}
+
 bool runtime::Tensor::get_stale() const
 {
     return m_stale;
@@ -81,6 +171,21 @@ bool runtime::Tensor::get_stale() const
 void runtime::Tensor::set_stale(bool val)
 {
     m_stale = val;
+    if (val)
+    {
+        m_version = next_version();
+    }
+}
+
+size_t runtime::Tensor::get_version() const
+{
+    return m_version;
+}
+
+size_t runtime::Tensor::next_version()
+{
+    static std::atomic<size_t> s_version{0};
+    return ++s_version;
 }
 
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
@@ -100,3 +205,70 @@ void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
     source.read(buffer.get_ptr(), size);
     write(buffer.get_ptr(), size);
 }
+
+namespace
+{
+    // Tensor whose staged write is running on this thread. Its write() must not wait for
+    // the pending write, which is the one in progress.
+    thread_local const runtime::Tensor* s_staging_tensor = nullptr;
+}
+
+void runtime::Tensor::write_async(const void* p, size_t n)
+{
+    wait_for_write_ready();
+    lock_guard<mutex> lock(m_pending_mutex);
+    m_pending_write = StagingQueue::get().enqueue([this, p, n]() {
+        s_staging_tensor = this;
+        try
+        {
+            write(p, n);
+        }
+        catch (...)
+        {
+            s_staging_tensor = nullptr;
+            throw;
+        }
+        s_staging_tensor = nullptr;
+    });
+    m_has_pending_write.store(true, memory_order_release);
+}
+
+void runtime::Tensor::wait_for_pending_write() const
+{
+    if (s_staging_tensor == this || !m_has_pending_write.load(memory_order_acquire))
+    {
+        return;
+    }
+    // Waiters queue on the lock and the flag is only cleared once the copy has landed, so
+    // no waiter returns early. Moving clears the fence so a failed copy is reported once.
+    lock_guard<mutex> lock(m_pending_mutex);
+    if (m_pending_write.valid())
+    {
+        m_pending_write.wait();
+        auto pending = move(m_pending_write);
+        m_has_pending_write.store(false, memory_order_release);
+        pending.get();
+    }
+}
+
+void runtime::Tensor::wait_for_pending_write_nothrow() const noexcept
+{
+    try
+    {
+        wait_for_pending_write();
+    }
+    catch (...)
+    {
+        // Nobody is left to report a failed copy to
+    }
+}
+
+void runtime::Tensor::wait_for_read_ready()
+{
+    wait_for_pending_write();
+}
+
+void runtime::Tensor::wait_for_write_ready()
+{
+    wait_for_read_ready();
+}
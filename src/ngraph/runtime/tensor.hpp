@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -35,13 +38,16 @@ namespace ngraph
             Tensor(const std::shared_ptr<ngraph::descriptor::Tensor>& descriptor)
                 : m_descriptor(descriptor)
                 , m_stale(true)
+                , m_version(next_version())
                 , m_original_partial_shape(descriptor->get_partial_shape())
             {
             }
 
         public:
-            virtual ~Tensor() {}
-            Tensor& operator=(const Tensor&) = default;
+            /// \brief Waits for a staged write, which still refers to this tensor
+            virtual ~Tensor();
+            /// \brief Copies the tensor description; a staged write is not carried over
+            Tensor& operator=(const Tensor&);
 
             /// \brief Get tensor shape
             /// \return const reference to a Shape
@@ -89,24 +95,53 @@ namespace ngraph
 
             /// \brief Set the stale value of the tensor. A tensor is stale if its data is
             /// changed.
+            ///
+            /// Executables may reuse results computed from a tensor that is not stale. Mark
+            /// the tensor stale after changing its data; it can be marked not stale again
+            /// once it has been passed to a call, and results derived from it will then be
+            /// reused until the next change.
             void set_stale(bool val);
 
+            /// \brief Get the data version of the tensor.
+            /// \return A value, unique across all tensors, that changes every time the tensor
+            /// is marked stale. Executables with several execution contexts compare it with the
+            /// version each context last computed from.
+            size_t get_version() const;
+
             /// \brief Write bytes directly into the tensor
+            ///
+            /// Waits for a write staged with write_async() to land first, so writes land in
+            /// the order they were issued.
             /// \param p Pointer to source of data
             /// \param n Number of bytes to write, must be integral number of elements.
             virtual void write(const void* p, size_t n) = 0;
 
             /// \brief Read bytes directly from the tensor
+            ///
+            /// Waits for a write staged with write_async() to land first.
             /// \param p Pointer to destination for data
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Stage bytes into the tensor on a background copy thread
+            ///
+            /// The copy is queued and the call returns immediately, so the caller can prepare
+            /// the next pipeline slot while a call consumes this one. The source buffer must
+            /// stay valid, and the tensor alive, until wait_for_write_ready() or
+            /// wait_for_read_ready() returns. Executables wait on their inputs before running.
+            /// \param p Pointer to source of data
+            /// \param n Number of bytes to write, must be integral number of elements.
+            virtual void write_async(const void* p, size_t n);
+
             /// \brief check tensor for new data, call may block.
             ///    backends may use this to ensure tensor is updated (eg: lazy eval).
-            virtual void wait_for_read_ready() {}
+            ///    Blocks until any write staged with write_async() has landed and rethrows
+            ///    an exception raised by the copy.
+            virtual void wait_for_read_ready();
             /// \brief notify tensor of new data, call may block.
             ///    backends may use this as indication of new data in tensor.
-            virtual void wait_for_write_ready() {}
+            ///    Blocks until the tensor can be overwritten, i.e. any staged write has landed.
+            virtual void wait_for_write_ready();
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source) NGRAPH_DEPRECATED(
@@ -114,9 +149,25 @@ namespace ngraph
                 "size) followed by this->write(buf_ptr, size)");
 
         protected:
+            static size_t next_version();
+            /// \brief Blocks until a staged write has landed and rethrows its exception once.
+            ///        Implementations of read(), write() and copy_from() call this before
+            ///        touching their buffer. Returns at once on the thread running the staged
+            ///        write itself.
+            void wait_for_pending_write() const;
+            /// \brief Like wait_for_pending_write() but drops the exception. Destructors of
+            ///        tensors that own their buffer call this before releasing it.
+            void wait_for_pending_write_nothrow() const noexcept;
+
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
+            size_t m_version;
             PartialShape m_original_partial_shape;
+            // Staged write, guarded by m_pending_mutex. The flag lets the common case of no
+            // staged write skip the lock; several execution contexts may wait concurrently.
+            mutable std::shared_future<void> m_pending_write;
+            mutable std::atomic<bool> m_has_pending_write{false};
+            mutable std::mutex m_pending_mutex;
         };
     }
 }
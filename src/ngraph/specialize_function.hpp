@@ -123,7 +123,8 @@ namespace ngraph
     ///          the corresponding parameter.
     /// \param constant_folding If flag is true, constant propagation is applied
     /// \param share_constants If flag is true, cloned function will have shared constants with
-    ///          original function.
+    ///          original function. Otherwise constants are cloned as new nodes, which still
+    ///          share their data with the original.
     /// \return A clone of f, with the parameter element types, shapes, and values specialized.
     /// \throws CheckFailure if parameter_element_types, parameter_shapes is not valid
     ///         (see details).
@@ -0,0 +1,410 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+
+#include "ngraph/stack_functions.hpp"
+#include "ngraph/attribute_adapter.hpp"
+#include "ngraph/attribute_visitor.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/slice.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using NodeMap = unordered_map<Node*, shared_ptr<Node>>;
+using ValueMap = unordered_map<Node*, OutputVector>;
+
+static void throw_mismatch(const Node& a, const Node& b)
+{
+    throw ngraph_error("stack_functions: " + a.get_name() + " does not match " + b.get_name());
+}
+
+namespace
+{
+    // Records the attributes of a node as strings so that two nodes can be compared
+    class AttributeRecorder : public AttributeVisitor
+    {
+    public:
+        using AttributeVisitor::on_adapter;
+
+        void on_adapter(const string& name, ValueAccessor<void>& /* adapter */) override
+        {
+            // No generic way to read it; nodes that only differ here are not told apart
+            m_values[name] = "?";
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            m_values[name] = adapter.get();
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            record(name, adapter.get());
+        }
+
+        const map<string, string>& get_values() const { return m_values; }
+
+    private:
+        template <typename T>
+        void record(const string& name, const T& value)
+        {
+            ostringstream ss;
+            ss << value;
+            m_values[name] = ss.str();
+        }
+        template <typename T>
+        void record(const string& name, const vector<T>& values)
+        {
+            ostringstream ss;
+            for (auto& value : values)
+            {
+                ss << value << ",";
+            }
+            m_values[name] = ss.str();
+        }
+
+        map<string, string> m_values;
+    };
+}
+
+// Constants may differ in value; every other op must have the same attributes
+static bool same_attributes(Node& a, Node& b)
+{
+    if (is_type<op::v0::Constant>(&a))
+    {
+        return true;
+    }
+    AttributeRecorder attributes_a;
+    AttributeRecorder attributes_b;
+    a.visit_attributes(attributes_a);
+    b.visit_attributes(attributes_b);
+    return attributes_a.get_values() == attributes_b.get_values();
+}
+
+// Maps every node of `reference` to the node at the same position in `other`
+static void match_structure(const shared_ptr<Function>& reference,
+                            const shared_ptr<Function>& other,
+                            NodeMap& node_map)
+{
+    if (reference->get_parameters().size() != other->get_parameters().size() ||
+        reference->get_results().size() != other->get_results().size())
+    {
+        throw ngraph_error("stack_functions: " + other->get_name() +
+                           " has a different number of parameters or results than " +
+                           reference->get_name());
+    }
+
+    vector<pair<shared_ptr<Node>, shared_ptr<Node>>> pending;
+    for (size_t i = 0; i < reference->get_parameters().size(); ++i)
+    {
+        pending.push_back({reference->get_parameters()[i], other->get_parameters()[i]});
+    }
+    for (size_t i = 0; i < reference->get_results().size(); ++i)
+    {
+        pending.push_back({reference->get_results()[i], other->get_results()[i]});
+    }
+
+    while (!pending.empty())
+    {
+        auto a = pending.back().first;
+        auto b = pending.back().second;
+        pending.pop_back();
+
+        auto it = node_map.find(a.get());
+        if (it != node_map.end())
+        {
+            if (it->second != b)
+            {
+                throw_mismatch(*a, *b);
+            }
+            continue;
+        }
+
+        if (a->get_type_info() != b->get_type_info() ||
+            a->get_input_size() != b->get_input_size() ||
+            a->get_output_size() != b->get_output_size() || !same_attributes(*a, *b))
+        {
+            throw_mismatch(*a, *b);
+        }
+        for (size_t i = 0; i < a->get_output_size(); ++i)
+        {
+            if (a->get_output_element_type(i) != b->get_output_element_type(i) ||
+                !a->get_output_partial_shape(i).same_scheme(b->get_output_partial_shape(i)))
+            {
+                throw_mismatch(*a, *b);
+            }
+        }
+        node_map[a.get()] = b;
+
+        for (size_t i = 0; i < a->get_input_size(); ++i)
+        {
+            auto source_a = a->input_value(i);
+            auto source_b = b->input_value(i);
+            if (source_a.get_index() != source_b.get_index())
+            {
+                throw_mismatch(*a, *b);
+            }
+            pending.push_back({source_a.get_node_shared_ptr(), source_b.get_node_shared_ptr()});
+        }
+    }
+}
+
+// Concatenates the payloads of equally shaped constants along a new leading axis
+static shared_ptr<op::v0::Constant>
+    stack_constants(const vector<shared_ptr<op::v0::Constant>>& constants,
+                    const Shape& stacked_shape)
+{
+    const element::Type& et = constants.at(0)->get_output_element_type(0);
+    size_t size = shape_size(constants[0]->get_output_shape(0)) * et.size();
+    vector<char> data(size * constants.size());
+    for (size_t k = 0; k < constants.size(); ++k)
+    {
+        memcpy(data.data() + k * size, constants[k]->get_data_ptr(), size);
+    }
+    return make_shared<op::v0::Constant>(et, stacked_shape, data.data());
+}
+
+// Returns the constants feeding input `index` of every node in `group`, or an empty vector
+static vector<shared_ptr<op::v0::Constant>> get_constant_inputs(const NodeVector& group,
+                                                                size_t index)
+{
+    vector<shared_ptr<op::v0::Constant>> constants;
+    for (auto& node : group)
+    {
+        auto constant = as_type_ptr<op::v0::Constant>(node->get_argument(index));
+        if (!constant || !constant->get_output_element_type(0).is_real())
+        {
+            return {};
+        }
+        constants.push_back(constant);
+    }
+    return constants;
+}
+
+// [M, N] x [N, P] per function becomes one [K, M, N] x [K, N, P] BatchMatMul
+static bool stack_dot(const NodeVector& group, const vector<OutputVector>& args, ValueMap& values)
+{
+    auto dot = as_type_ptr<op::v0::Dot>(group[0]);
+    if (!dot || dot->get_reduction_axes_count() != 1 || dot->get_input_shape(0).size() != 2 ||
+        dot->get_input_shape(1).size() != 2)
+    {
+        return false;
+    }
+    auto weights = get_constant_inputs(group, 1);
+    if (weights.empty())
+    {
+        return false;
+    }
+
+    size_t K = group.size();
+    size_t M = dot->get_input_shape(0)[0];
+    size_t N = dot->get_input_shape(0)[1];
+    size_t P = dot->get_input_shape(1)[1];
+
+    // Inputs are joined and results split along the outermost axis, so a backend that can
+    // place Concat and Slice in place (CPUMemoryOptimization on CPU) does so without copies
+    OutputVector inputs;
+    for (size_t k = 0; k < K; ++k)
+    {
+        inputs.push_back(args[k][0]);
+    }
+    auto stacked_input = make_shared<op::v0::Reshape>(
+        make_shared<op::v0::Concat>(inputs, 0), AxisVector{0, 1}, Shape{K, M, N});
+    auto stacked_weights = stack_constants(weights, Shape{K, N, P});
+    auto batch_dot = make_shared<op::v0::BatchMatMul>(stacked_input, stacked_weights);
+    auto stacked_output =
+        make_shared<op::v0::Reshape>(batch_dot, AxisVector{0, 1, 2}, Shape{K * M, P});
+
+    for (size_t k = 0; k < K; ++k)
+    {
+        values[group[0].get()].push_back(make_shared<op::v0::Slice>(
+            stacked_output, Coordinate{k * M, 0}, Coordinate{(k + 1) * M, P}));
+    }
+    return true;
+}
+
+// Convolutions with filters [O, C, ...] per function become one GroupConvolution with K groups
+static bool stack_convolution(const NodeVector& group,
+                              const vector<OutputVector>& args,
+                              ValueMap& values)
+{
+    auto conv = as_type_ptr<op::v0::Convolution>(group[0]);
+    if (!conv || conv->get_pad_type() != op::PadType::EXPLICIT)
+    {
+        return false;
+    }
+    for (auto& node : group)
+    {
+        auto other = static_pointer_cast<op::v0::Convolution>(node);
+        if (other->get_window_movement_strides() != conv->get_window_movement_strides() ||
+            other->get_window_dilation_strides() != conv->get_window_dilation_strides() ||
+            other->get_padding_below() != conv->get_padding_below() ||
+            other->get_padding_above() != conv->get_padding_above() ||
+            other->get_data_dilation_strides() != conv->get_data_dilation_strides() ||
+            other->get_pad_type() != conv->get_pad_type())
+        {
+            return false;
+        }
+    }
+    auto filters = get_constant_inputs(group, 1);
+    if (filters.empty())
+    {
+        return false;
+    }
+
+    size_t K = group.size();
+    Shape stacked_filters_shape = conv->get_input_shape(1);
+    stacked_filters_shape.insert(stacked_filters_shape.begin(), K);
+
+    OutputVector inputs;
+    for (size_t k = 0; k < K; ++k)
+    {
+        inputs.push_back(args[k][0]);
+    }
+    auto stacked_input = make_shared<op::v0::Concat>(inputs, 1);
+    auto group_conv =
+        make_shared<op::v0::GroupConvolution>(stacked_input,
+                                              stack_constants(filters, stacked_filters_shape),
+                                              conv->get_window_movement_strides(),
+                                              conv->get_window_dilation_strides(),
+                                              conv->get_padding_below(),
+                                              conv->get_padding_above(),
+                                              conv->get_data_dilation_strides());
+
+    Shape output_shape = conv->get_output_shape(0);
+    size_t O = output_shape[1];
+    for (size_t k = 0; k < K; ++k)
+    {
+        Coordinate lower_bounds(output_shape.size(), 0);
+        Coordinate upper_bounds(output_shape);
+        lower_bounds[1] = k * O;
+        upper_bounds[1] = (k + 1) * O;
+        values[group[0].get()].push_back(
+            make_shared<op::v0::Slice>(group_conv, lower_bounds, upper_bounds));
+    }
+    return true;
+}
+
+shared_ptr<Function> ngraph::stack_functions(const vector<shared_ptr<Function>>& functions)
+{
+    NGRAPH_CHECK(!functions.empty(), "stack_functions requires at least one function");
+
+    size_t K = functions.size();
+    const auto& reference = functions[0];
+    vector<NodeMap> peers(K);
+    for (size_t k = 0; k < K; ++k)
+    {
+        match_structure(reference, functions[k], peers[k]);
+    }
+
+    // New outputs of every reference node, per function
+    vector<ValueMap> values(K);
+    for (auto& node : reference->get_ordered_ops())
+    {
+        NodeVector group;
+        vector<OutputVector> args;
+        for (size_t k = 0; k < K; ++k)
+        {
+            group.push_back(peers[k].at(node.get()));
+            OutputVector new_args;
+            for (auto& input : node->inputs())
+            {
+                auto source = input.get_source_output();
+                new_args.push_back(values[k].at(source.get_node())[source.get_index()]);
+            }
+            args.push_back(new_args);
+        }
+
+        ValueMap stacked;
+        if (K > 1 && (stack_dot(group, args, stacked) || stack_convolution(group, args, stacked)))
+        {
+            for (size_t k = 0; k < K; ++k)
+            {
+                values[k][node.get()] = OutputVector{stacked[node.get()][k]};
+            }
+            continue;
+        }
+
+        for (size_t k = 0; k < K; ++k)
+        {
+            auto clone = group[k]->clone_with_new_inputs(args[k]);
+            clone->set_friendly_name(group[k]->get_friendly_name());
+            values[k][node.get()] = clone->outputs();
+        }
+    }
+
+    ParameterVector parameters;
+    ResultVector results;
+    for (size_t k = 0; k < K; ++k)
+    {
+        for (auto& parameter : reference->get_parameters())
+        {
+            parameters.push_back(static_pointer_cast<op::v0::Parameter>(
+                values[k].at(parameter.get())[0].get_node_shared_ptr()));
+        }
+        for (auto& result : reference->get_results())
+        {
+            results.push_back(static_pointer_cast<op::v0::Result>(
+                values[k].at(result.get())[0].get_node_shared_ptr()));
+        }
+    }
+    return make_shared<Function>(results, parameters);
+}
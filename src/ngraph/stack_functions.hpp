@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    /// \brief Combines K structurally identical functions into one function that evaluates all
+    ///        of them in a single call.
+    ///
+    /// The functions must have the same topology, op types, op attributes, element types and
+    /// shapes; they may differ only in the values of their constants (typically weights). The
+    /// stacked function takes the parameters of functions[0], then those of functions[1], and
+    /// so on, and returns their results in the same order.
+    ///
+    /// Corresponding `Dot` ops with rank 2 constant weights are merged into a single
+    /// `BatchMatMul` over weights stacked along a new leading axis, and corresponding
+    /// `Convolution` ops with constant filters are merged into a single `GroupConvolution`
+    /// with one group per function. All other ops are cloned once per function.
+    ///
+    /// The merged ops read their inputs through a Concat and return their results through
+    /// Slices. For the `BatchMatMul` both run along the outermost axis, so the CPU backend
+    /// places them in place unless an input is a parameter, a constant or the output of an
+    /// op that itself runs in place. For the `GroupConvolution` they run along the channel
+    /// axis and copy unless the batch size is 1.
+    ///
+    /// \param functions The functions to stack. Must be non-empty.
+    /// \return The stacked function.
+    /// \throws ngraph_error if the functions are not structurally identical.
+    NGRAPH_API
+    std::shared_ptr<Function>
+        stack_functions(const std::vector<std::shared_ptr<Function>>& functions);
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/except.hpp"
+#include "kv_cache_state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ngraph::KVCacheState::KVCacheState(size_t sequences,
+                                   size_t max_length,
+                                   size_t key_position_bytes,
+                                   size_t value_position_bytes)
+    : State()
+    , m_sequences(sequences)
+    , m_max_length(max_length)
+    , m_key_bytes(key_position_bytes)
+    , m_value_bytes(value_position_bytes)
+    , m_length(0)
+    , m_keys(sequences * max_length * key_position_bytes)
+    , m_values(sequences * max_length * value_position_bytes)
+{
+}
+
+void ngraph::KVCacheState::activate() {}
+
+void ngraph::KVCacheState::deactivate() {}
+
+void ngraph::KVCacheState::reset()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_length = 0;
+}
+
+void ngraph::KVCacheState::stage(const void* keys,
+                                 const void* values,
+                                 size_t positions,
+                                 size_t stride)
+{
+    if (m_length + positions > m_max_length)
+    {
+        throw ngraph_error("KV cache overflow: " + to_string(m_length) + " cached and " +
+                           to_string(positions) + " new positions exceed the maximum length of " +
+                           to_string(m_max_length));
+    }
+    for (size_t s = 0; s < m_sequences; s++)
+    {
+        memcpy(m_keys.data() + (s * m_max_length + m_length) * m_key_bytes,
+               static_cast<const char*>(keys) + s * stride * m_key_bytes,
+               positions * m_key_bytes);
+        memcpy(m_values.data() + (s * m_max_length + m_length) * m_value_bytes,
+               static_cast<const char*>(values) + s * stride * m_value_bytes,
+               positions * m_value_bytes);
+    }
+}
+
+void ngraph::KVCacheState::commit(size_t positions)
+{
+    m_length += positions;
+}
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "state.hpp"
+
+namespace ngraph
+{
+    /// \brief Persistent key/value cache for autoregressive attention.
+    ///
+    /// Keys and values of each sequence are kept in preallocated buffers of max_length
+    /// positions, of which the first get_length() are valid. Heads are expected to be
+    /// folded into the sequence (batch) dimension. The cache belongs to the executable, so
+    /// execution contexts running concurrently serialize on get_mutex().
+    class NGRAPH_API KVCacheState : public State
+    {
+    public:
+        KVCacheState(size_t sequences,
+                     size_t max_length,
+                     size_t key_position_bytes,
+                     size_t value_position_bytes);
+        virtual void activate() override;
+        virtual void deactivate() override;
+        virtual void reset() override;
+        virtual ~KVCacheState() override {}
+        size_t get_length() const { return m_length; }
+        size_t get_max_length() const { return m_max_length; }
+        /// \brief Copy the keys and values of the next positions into the cache, after the
+        ///        valid prefix. They only become valid once commit() is called, so a failed
+        ///        step leaves the cache as it was.
+        /// \param keys Keys laid out as [sequences, stride, key_position_bytes]
+        /// \param values Values laid out as [sequences, stride, value_position_bytes]
+        /// \param positions Number of leading positions staged for every sequence
+        /// \param stride Number of positions between sequences in keys and values
+        void stage(const void* keys, const void* values, size_t positions, size_t stride);
+        /// \brief Extend the valid prefix over positions previously staged
+        void commit(size_t positions);
+        /// \brief Held across stage(), the reads of the step and commit()
+        std::mutex& get_mutex() { return m_mutex; }
+        /// \brief Keys of sequence s, laid out as [max_length, key_position_bytes]
+        const char* get_keys(size_t s) const
+        {
+            return m_keys.data() + s * m_max_length * m_key_bytes;
+        }
+        /// \brief Values of sequence s, laid out as [max_length, value_position_bytes]
+        const char* get_values(size_t s) const
+        {
+            return m_values.data() + s * m_max_length * m_value_bytes;
+        }
+
+    protected:
+        size_t m_sequences;
+        size_t m_max_length;
+        size_t m_key_bytes;
+        size_t m_value_bytes;
+        size_t m_length;
+        std::vector<char> m_keys;
+        std::vector<char> m_values;
+        std::mutex m_mutex;
+    };
+}
@@ -29,6 +29,9 @@ namespace ngraph
         virtual void deactivate() = 0;
         bool is_active() const { return m_is_active; }
         void set_active(bool flag) { m_is_active = flag; }
+        /// \brief Return the state to what it was at construction, e.g. to start a new
+        /// sequence. States without anything to forget ignore this.
+        virtual void reset() {}
         virtual ~State() {}
 
     protected:
@@ -62,6 +62,8 @@ runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type, co
 
 runtime::gpu::GPUTensor::~GPUTensor()
 {
+    // A staged write may still target this buffer
+    wait_for_pending_write_nothrow();
     if (!m_custom_memory && (m_allocated_buffer_pool != nullptr))
     {
         runtime::gpu::free_gpu_buffer(m_allocated_buffer_pool);
@@ -70,11 +72,13 @@ runtime::gpu::GPUTensor::~GPUTensor()
 
 void runtime::gpu::GPUTensor::write(const void* source, size_t n_bytes)
 {
+    wait_for_pending_write();
     runtime::gpu::cuda_memcpyHtD(m_allocated_buffer_pool, source, n_bytes);
 }
 
 void runtime::gpu::GPUTensor::read(void* target, size_t n_bytes) const
 {
+    wait_for_pending_write();
     runtime::gpu::cuda_memcpyDtH(target, m_allocated_buffer_pool, n_bytes);
 }
 
@@ -92,6 +96,8 @@ void runtime::gpu::GPUTensor::copy_from(const runtime::Tensor& source)
         {
             throw invalid_argument("runtime::gpu::GPUTensor::copy_from element types must match.");
         }
+        wait_for_pending_write();
+        src.wait_for_pending_write();
         runtime::gpu::cuda_memcpyDtD(
             m_allocated_buffer_pool, src.m_allocated_buffer_pool, source.get_size_in_bytes());
     }
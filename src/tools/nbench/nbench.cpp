@@ -42,6 +42,7 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -169,6 +170,7 @@ int main(int argc, char** argv)
     bool dump_results = false;
     bool dot_file = false;
     bool double_buffer = false;
+    string profile_out;
     string visualize_output_format = ".pdf";
 
     for (int i = 1; i < argc; i++)
@@ -236,6 +238,10 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "--profile_out")
+        {
+            profile_out = argv[++i];
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -269,6 +275,11 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    else if (!directory.empty() && !profile_out.empty())
+    {
+        cout << "--profile_out needs a single model\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -293,6 +304,9 @@ OPTIONS
         --dump_results            Dump result tensors to standard output.
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        --profile_out             Save an execution profile of the run to the given file. Load it
+                                  with ExecutionProfile::load and pass it to CPU_Backend::compile
+                                  to compile the same model with it.
 )###";
         return 1;
     }
@@ -440,22 +454,24 @@ OPTIONS
                 ss << t1.get_milliseconds();
                 cout << "deserialize took " << ss.str() << "ms\n";
                 vector<runtime::PerformanceCounter> perf_data;
+                // A profile needs the performance counters
+                bool timing = timing_detail || !profile_out.empty();
                 if (double_buffer)
                 {
                     NGRAPH_CHECK(!dump_results,
                                  "'dump_results' not implemented in double buffer mode");
                     perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                        f, backend, iterations, timing, warmup_iterations, copy_data);
                 }
                 else
                 {
-                    perf_data = run_benchmark(f,
-                                              backend,
-                                              iterations,
-                                              timing_detail,
-                                              warmup_iterations,
-                                              copy_data,
-                                              dump_results);
+                    perf_data = run_benchmark(
+                        f, backend, iterations, timing, warmup_iterations, copy_data, dump_results);
+                }
+                if (!profile_out.empty())
+                {
+                    runtime::ExecutionProfile(perf_data).save(profile_out);
+                    cout << "execution profile saved to " << profile_out << "\n";
                 }
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
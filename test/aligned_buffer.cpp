@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -48,3 +49,70 @@ TEST(aligned_buffer, move)
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, huge_page_allocator)
+{
+    runtime::HugePageAllocator allocator(runtime::HugePageAllocator::Mode::TRANSPARENT, true);
+    size_t size = 3 * runtime::HugePageAllocator::huge_page_size;
+    {
+        runtime::AlignedBuffer buffer(size, 4096, &allocator);
+        size_t addr = reinterpret_cast<size_t>(buffer.get_ptr()) % 4096;
+        EXPECT_EQ(addr, 0);
+        auto data = buffer.get_ptr<char>();
+        data[0] = 1;
+        data[size - 1] = 2;
+        EXPECT_EQ(data[0] + data[size - 1], 3);
+    }
+    {
+        // Transparent mappings are only page aligned by mmap; the allocator aligns them
+        void* ptr = allocator.malloc(size + 1, 64);
+        EXPECT_EQ(reinterpret_cast<size_t>(ptr) % runtime::HugePageAllocator::huge_page_size, 0);
+        allocator.free(ptr);
+    }
+    {
+        // Below a huge page the system allocator is used
+        runtime::AlignedBuffer buffer(100, 64, &allocator);
+        size_t addr = reinterpret_cast<size_t>(buffer.get_ptr()) % 64;
+        EXPECT_EQ(addr, 0);
+    }
+    EXPECT_EQ(allocator.get_recycled_size(), 0);
+}
+
+TEST(aligned_buffer, huge_page_allocator_recycle)
+{
+    size_t page = runtime::HugePageAllocator::huge_page_size;
+    runtime::HugePageAllocator allocator(
+        runtime::HugePageAllocator::Mode::EXPLICIT, false, 4 * page);
+
+    void* first = allocator.malloc(2 * page, 64);
+    allocator.free(first);
+    EXPECT_EQ(allocator.get_recycled_size(), 2 * page);
+
+    // A request of the same rounded size gets the recycled mapping back
+    void* second = allocator.malloc(2 * page - 1, 64);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(allocator.get_recycled_size(), 0);
+
+    // Freed mappings beyond the recycle limit are released
+    void* large = allocator.malloc(8 * page, 64);
+    allocator.free(large);
+    EXPECT_EQ(allocator.get_recycled_size(), 0);
+    allocator.free(second);
+    EXPECT_EQ(allocator.get_recycled_size(), 2 * page);
+
+}
+
+TEST(aligned_buffer, huge_page_allocator_exact_size)
+{
+    size_t page = runtime::HugePageAllocator::huge_page_size;
+    runtime::HugePageAllocator allocator(
+        runtime::HugePageAllocator::Mode::TRANSPARENT, false, 4 * page);
+
+    // Mappings are already aligned, so AlignedBuffer adds no slack that would round a whole
+    // huge page request up to the next page
+    {
+        runtime::AlignedBuffer buffer(page, 64, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(buffer.get_ptr()) % page, 0);
+    }
+    EXPECT_EQ(allocator.get_recycled_size(), page);
+}
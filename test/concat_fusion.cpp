@@ -30,6 +30,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/pass/concat_fusion.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
@@ -298,4 +299,101 @@ TEST(concat_fusion, pass_property)
         ASSERT_TRUE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
         ASSERT_FALSE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
     }
+
+    {
+        auto pass = std::make_shared<ngraph::pass::ConcatSliceFusion>();
+        ASSERT_TRUE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
+        ASSERT_FALSE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
+    }
+}
+
+static void check_concat_slice_fusion(const std::function<shared_ptr<Function>()>& generate_func,
+                                      size_t expected_concats,
+                                      size_t expected_slices)
+{
+    auto baseline_f = generate_func();
+    auto optimized_f = generate_func();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConcatSliceFusion>();
+    pass_manager.run_passes(optimized_f);
+
+    test::Uniform<float> rng(0.0f, 100.0f);
+    vector<vector<float>> args;
+    for (auto& param : baseline_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto baseline_results = execute(baseline_f, args, "INTERPRETER");
+    auto optimized_results = execute(optimized_f, args, "INTERPRETER");
+    for (size_t i = 0; i < baseline_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(baseline_results.at(i), optimized_results.at(i)));
+    }
+    ASSERT_EQ(count_ops_of_type<op::v0::Concat>(optimized_f), expected_concats);
+    ASSERT_EQ(count_ops_of_type<op::v0::Slice>(optimized_f), expected_slices);
+}
+
+TEST(concat_fusion, concat_slice_aligned)
+{
+    auto generate_func = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3});
+        auto C = make_shared<op::v0::Parameter>(element::f32, Shape{1, 3});
+        auto concat = make_shared<op::v0::Concat>(OutputVector{A, B, C}, 0);
+        auto slice_a = make_shared<op::v0::Slice>(concat, Coordinate{0, 0}, Coordinate{2, 3});
+        auto slice_bc = make_shared<op::v0::Slice>(concat, Coordinate{2, 0}, Coordinate{7, 3});
+        auto slice_b = make_shared<op::v0::Slice>(concat, Coordinate{3, 1}, Coordinate{5, 3});
+        return make_shared<Function>(OutputVector{slice_a, slice_bc, slice_b},
+                                     ParameterVector{A, B, C});
+    };
+
+    // slice_a is A, slice_bc is a concat of B and C, slice_b a slice of B
+    check_concat_slice_fusion(generate_func, 1, 1);
+}
+
+TEST(concat_fusion, concat_slice_push)
+{
+    auto generate_func = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{4, 5});
+        auto concat = make_shared<op::v0::Concat>(OutputVector{A, B}, 1);
+        auto slice = make_shared<op::v0::Slice>(concat, Coordinate{1, 2}, Coordinate{3, 6});
+        return make_shared<Function>(OutputVector{slice}, ParameterVector{A, B});
+    };
+
+    check_concat_slice_fusion(generate_func, 1, 2);
+}
+
+TEST(concat_fusion, concat_slice_no_push_with_fan_out)
+{
+    auto generate_func = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{4, 5});
+        auto concat = make_shared<op::v0::Concat>(OutputVector{A, B}, 1);
+        auto slice = make_shared<op::v0::Slice>(concat, Coordinate{1, 2}, Coordinate{3, 6});
+        return make_shared<Function>(OutputVector{slice, concat}, ParameterVector{A, B});
+    };
+
+    check_concat_slice_fusion(generate_func, 1, 1);
+}
+
+TEST(concat_fusion, slice_slice)
+{
+    auto generate_func = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{8, 4});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4});
+        auto slice_1 = make_shared<op::v0::Slice>(A, Coordinate{1, 0}, Coordinate{7, 4});
+        auto slice_2 = make_shared<op::v0::Slice>(
+            slice_1, Coordinate{1, 1}, Coordinate{6, 4}, Strides{2, 2});
+        auto concat = make_shared<op::v0::Concat>(OutputVector{slice_1, B}, 0);
+        auto slice_3 = make_shared<op::v0::Slice>(concat, Coordinate{0, 0}, Coordinate{6, 4});
+        return make_shared<Function>(OutputVector{slice_2, slice_3}, ParameterVector{A, B});
+    };
+
+    // slice_2 reads A directly, and slice_3 is slice_1
+    check_concat_slice_fusion(generate_func, 0, 2);
 }
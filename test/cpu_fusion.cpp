@@ -61,7 +61,9 @@
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/broadcast_binary.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
@@ -71,11 +73,14 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_broadcast_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -274,6 +279,235 @@ TEST(cpu_fusion, conv_bias_bprop)
     ASSERT_EQ(ccg, 1);
 }
 
+TEST(cpu_fusion, conv_bias_relu_bprop)
+{
+    Shape shape{2, 2, 1, 1};
+    auto data_batch = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto filters = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto delta = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{shape[1]});
+    auto pbroadcast = std::make_shared<op::v0::Broadcast>(bias, shape, AxisSet{0, 2, 3});
+    auto conv = std::make_shared<op::v0::Convolution>(data_batch, filters);
+    auto relu = std::make_shared<op::v0::Relu>(std::make_shared<op::v1::Add>(conv, pbroadcast));
+
+    ngraph::autodiff::Adjoints adjoints(OutputVector{relu}, OutputVector{delta});
+    auto df = make_shared<Function>(OutputVector{adjoints.backprop_output(data_batch),
+                                                 adjoints.backprop_output(filters),
+                                                 adjoints.backprop_output(bias)},
+                                    ParameterVector{data_batch, filters, bias, delta});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUConvBackpropFusion>();
+    pass_manager.run_passes(df);
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasBackprop>(df), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::ReluBackprop>(df), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::ConvolutionBackpropData>(df), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::ConvolutionBackpropFilters>(df), 0);
+}
+
+TEST(cpu_fusion, optimizer_update)
+{
+    auto scalar = [](const Shape& shape, float value) {
+        AxisSet axes;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            axes.insert(i);
+        }
+        auto c = op::v0::Constant::create(element::f32, Shape{}, {value});
+        return make_shared<op::v0::Broadcast>(c, shape, axes);
+    };
+    OutputVector outputs;
+    ParameterVector params;
+    for (auto shape : {Shape{4, 3}, Shape{7}})
+    {
+        auto param = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto grad = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto m = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto v = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto new_m =
+            make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(m, scalar(shape, 0.9f)),
+                                     make_shared<op::v1::Multiply>(grad, scalar(shape, 0.1f)));
+        auto new_v = make_shared<op::v1::Add>(
+            make_shared<op::v1::Multiply>(scalar(shape, 0.999f), v),
+            make_shared<op::v1::Multiply>(make_shared<op::v1::Multiply>(grad, grad),
+                                          scalar(shape, 0.001f)));
+        auto denom = make_shared<op::v1::Add>(make_shared<op::v0::Sqrt>(new_v),
+                                              scalar(shape, 1e-8f));
+        auto new_param = make_shared<op::v1::Subtract>(
+            param,
+            make_shared<op::v1::Multiply>(scalar(shape, 0.01f),
+                                          make_shared<op::v1::Divide>(new_m, denom)));
+        outputs.insert(outputs.end(), {new_param, new_m, new_v});
+        params.insert(params.end(), {param, grad, m, v});
+    }
+    auto func = make_shared<Function>(outputs, params);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::OptimizerUpdate>(func), 2);
+    ASSERT_EQ(count_ops_of_type<op::v0::Sqrt>(func), 0);
+
+    pass::Manager grouping_manager;
+    grouping_manager.register_pass<runtime::cpu::pass::CPUOptimizerUpdateFusion>();
+    grouping_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::OptimizerUpdate>(func), 1);
+    for (auto node : func->get_ops())
+    {
+        if (auto update = as_type_ptr<op::OptimizerUpdate>(node))
+        {
+            EXPECT_EQ(update->get_algorithm(), op::OptimizerUpdate::Algorithm::Adam);
+            EXPECT_EQ(update->get_parameter_count(), 2);
+        }
+    }
+}
+
+TEST(cpu_fusion, matmul_bias_affine_folding)
+{
+    Shape shape_norm{3};
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{4, 8});
+    auto weights = op::v0::Constant::create(element::f32, Shape{8, 3}, vector<float>(24, 0.5f));
+    auto norm = [&](float value) {
+        return op::v0::Constant::create(element::f32, shape_norm, {value, value, value});
+    };
+    auto dot = make_shared<op::v0::Dot>(input, weights);
+    auto bn = make_shared<op::v0::BatchNormInference>(
+        dot, norm(2.0f), norm(1.0f), norm(0.5f), norm(4.0f), 0.001);
+    auto scaled = make_shared<op::v1::Multiply>(
+        bn, make_shared<op::v0::Broadcast>(norm(3.0f), Shape{4, 3}, AxisSet{0}));
+    auto shifted = make_shared<op::v1::Add>(
+        scaled, make_shared<op::v0::Broadcast>(norm(-1.0f), Shape{4, 3}, AxisSet{0}));
+    auto func = make_shared<Function>(shifted, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::BatchNormInference>(func), 0);
+    // Every step of the chain is folded into the constant weights and bias
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(func), 0);
+    auto mmb = as_type_ptr<op::MatmulBias>(func->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(mmb);
+    EXPECT_EQ(mmb->get_input_size(), 3);
+    EXPECT_TRUE(is_type<op::v0::Constant>(mmb->get_argument(1)));
+    EXPECT_TRUE(is_type<op::v0::Constant>(mmb->get_argument(2)));
+}
+
+TEST(cpu_fusion, conv_input_affine_folding)
+{
+    Shape shape_input{1, 2, 3, 3};
+    auto input = make_shared<op::v0::Parameter>(element::f32, shape_input);
+    auto weights =
+        op::v0::Constant::create(element::f32, Shape{4, 2, 1, 1}, vector<float>(8, 0.5f));
+    auto scale = op::v0::Constant::create(element::f32, Shape{2}, {2.0f, 3.0f});
+    auto shift = op::v0::Constant::create(element::f32, Shape{2}, {1.0f, -1.0f});
+    auto affine = make_shared<op::v1::Add>(
+        make_shared<op::v1::Multiply>(
+            input, make_shared<op::v0::Broadcast>(scale, shape_input, AxisSet{0, 2, 3})),
+        make_shared<op::v0::Broadcast>(shift, shape_input, AxisSet{0, 2, 3}));
+    auto conv = make_shared<op::v0::Convolution>(affine, weights, Strides{1, 1}, Strides{1, 1});
+    auto func = make_shared<Function>(conv, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::v0::ConvolutionBias>(func), 1);
+    auto conv_bias = func->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::v0::ConvolutionBias>(conv_bias));
+    EXPECT_EQ(conv_bias->get_argument(0), input);
+}
+
+TEST(cpu_fusion, conv_input_affine_folding_data_dilation)
+{
+    Shape shape_input{1, 2, 3, 3};
+    auto input = make_shared<op::v0::Parameter>(element::f32, shape_input);
+    auto weights =
+        op::v0::Constant::create(element::f32, Shape{4, 2, 1, 1}, vector<float>(8, 0.5f));
+    auto scale = op::v0::Constant::create(element::f32, Shape{2}, {2.0f, 3.0f});
+    auto shift = op::v0::Constant::create(element::f32, Shape{2}, {1.0f, -1.0f});
+    auto affine = make_shared<op::v1::Add>(
+        make_shared<op::v1::Multiply>(
+            input, make_shared<op::v0::Broadcast>(scale, shape_input, AxisSet{0, 2, 3})),
+        make_shared<op::v0::Broadcast>(shift, shape_input, AxisSet{0, 2, 3}));
+    // The holes between dilated inputs are zero, not the shift
+    auto conv = make_shared<op::v0::Convolution>(affine,
+                                                 weights,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{2, 2});
+    auto func = make_shared<Function>(conv, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>(pass::FusionType::REGULAR_FUSIONS);
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::v0::ConvolutionBias>(func), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convolution>(func), 1);
+    EXPECT_EQ(func->get_results().at(0)->get_argument(0)->get_argument(0), affine);
+}
+
+TEST(cpu_fusion, broadcast_folding)
+{
+    Shape shape{2, 3, 4};
+    auto input = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto scale = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+    auto bias_broadcast = make_shared<op::v0::Broadcast>(bias, shape, AxisSet{0, 1});
+    auto add = make_shared<op::v1::Add>(input, bias_broadcast);
+    auto mul =
+        make_shared<op::v1::Multiply>(make_shared<op::v0::Broadcast>(scale, shape, AxisSet{0, 2}),
+                                      add);
+    auto equal = make_shared<op::v1::Equal>(mul, bias_broadcast);
+    auto func =
+        make_shared<Function>(OutputVector{mul, equal}, ParameterVector{input, bias, scale});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUBroadcastFolding>();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::BroadcastBinary>(func), 2);
+    // Equal isn't folded, so the bias broadcast stays for it
+    ASSERT_EQ(count_ops_of_type<op::v0::Broadcast>(func), 1);
+
+    auto new_mul = as_type_ptr<op::BroadcastBinary>(func->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_mul);
+    EXPECT_EQ(new_mul->get_kind(), op::BroadcastBinary::Kind::Multiply);
+    EXPECT_EQ(new_mul->get_argument(0), scale);
+    EXPECT_EQ(new_mul->get_broadcast_axes0(), (AxisSet{0, 2}));
+    EXPECT_EQ(new_mul->get_broadcast_axes1(), AxisSet{});
+    auto new_add = as_type_ptr<op::BroadcastBinary>(new_mul->get_argument(1));
+    ASSERT_TRUE(new_add);
+    EXPECT_EQ(new_add->get_kind(), op::BroadcastBinary::Kind::Add);
+    EXPECT_EQ(new_add->get_argument(0), input);
+    EXPECT_EQ(new_add->get_argument(1), bias);
+    EXPECT_EQ(new_add->get_broadcast_axes1(), (AxisSet{0, 1}));
+}
+
+TEST(cpu_fusion, broadcast_folding_skips_constants)
+{
+    // Scaled filters as left by the conv affine folds, followed by a use of the input
+    Shape shape{4, 2, 1, 1};
+    auto input = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto filters = op::v0::Constant::create(element::f32, shape, vector<float>(8, 0.5f));
+    auto scale = op::v0::Constant::create(element::f32, Shape{2}, {2.0f, 3.0f});
+    auto scaled = make_shared<op::v1::Multiply>(
+        filters, make_shared<op::v0::Broadcast>(scale, shape, AxisSet{0, 2, 3}));
+    auto shifted = make_shared<op::v1::Add>(
+        scaled, make_shared<op::v0::Broadcast>(scale, shape, AxisSet{0, 2, 3}));
+    auto add = make_shared<op::v1::Add>(input, shifted);
+    auto func = make_shared<Function>(add, ParameterVector{input});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUBroadcastFolding>();
+    pass_manager.run_passes(func);
+    // Nothing computed from constants alone is folded, so ConstantFolding still can be
+    EXPECT_EQ(count_ops_of_type<op::BroadcastBinary>(func), 0);
+    EXPECT_EQ(func->get_results().at(0)->get_argument(0), add);
+    EXPECT_EQ(add->get_argument(1), shifted);
+    EXPECT_EQ(shifted->get_argument(0), scaled);
+}
+
 TEST(cpu_fusion, fuse_conv_relu)
 {
     auto A = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 1, 2, 2});
@@ -62,6 +62,7 @@
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_bias_backprop.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
@@ -71,6 +72,7 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -404,6 +406,178 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_bias_bprop_n1c1h3w3)
         test::all_close(conv_test.expected_d_bias_val, read_vector<float>(conv_test.d_bias_val)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_bias_relu_bprop)
+{
+    auto make_function = []() {
+        Shape data_shape{2, 3, 6, 6};
+        Shape filters_shape{4, 3, 3, 3};
+        Shape bias_shape{4};
+        auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+        auto filters = make_shared<op::v0::Parameter>(element::f32, filters_shape);
+        auto bias = make_shared<op::v0::Parameter>(element::f32, bias_shape);
+        auto delta = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4, 3, 3});
+        auto conv = make_shared<op::v0::Convolution>(data,
+                                                     filters,
+                                                     Strides{2, 2},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     CoordinateDiff{0, 0});
+        auto bias_broadcast = make_shared<op::v0::Broadcast>(
+            bias, conv->get_output_shape(0), AxisSet{0, 2, 3});
+        auto relu = make_shared<op::v0::Relu>(make_shared<op::v1::Add>(conv, bias_broadcast));
+
+        ngraph::autodiff::Adjoints adjoints(OutputVector{relu}, OutputVector{delta});
+        return make_shared<Function>(OutputVector{adjoints.backprop_output(data),
+                                                  adjoints.backprop_output(filters),
+                                                  adjoints.backprop_output(bias)},
+                                     ParameterVector{data, filters, bias, delta});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    ASSERT_EQ(count_ops_of_type<op::ConvolutionBiasBackprop>(cpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::ReluBackprop>(cpu_f), 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_optimizer_update)
+{
+    auto scalar = [](const Shape& shape, float value) {
+        AxisSet axes;
+        for (size_t i = 0; i < shape.size(); i++)
+        {
+            axes.insert(i);
+        }
+        auto c = op::v0::Constant::create(element::f32, Shape{}, {value});
+        return make_shared<op::v0::Broadcast>(c, shape, axes);
+    };
+    // SGD with momentum for the first tensor and Adam for the other two
+    auto make_function = [&]() {
+        OutputVector outputs;
+        ParameterVector params;
+        Shape sgd_shape{3, 5};
+        auto param = make_shared<op::v0::Parameter>(element::f32, sgd_shape);
+        auto grad = make_shared<op::v0::Parameter>(element::f32, sgd_shape);
+        auto velocity = make_shared<op::v0::Parameter>(element::f32, sgd_shape);
+        auto new_velocity = make_shared<op::v1::Add>(
+            make_shared<op::v1::Multiply>(velocity, scalar(sgd_shape, 0.9f)), grad);
+        auto new_param = make_shared<op::v1::Subtract>(
+            param, make_shared<op::v1::Multiply>(scalar(sgd_shape, 0.1f), new_velocity));
+        outputs.insert(outputs.end(), {new_param, new_velocity});
+        params.insert(params.end(), {param, grad, velocity});
+
+        for (auto shape : {Shape{2, 3, 4}, Shape{40000}})
+        {
+            auto param = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto grad = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto m = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto v = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto new_m =
+                make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(m, scalar(shape, 0.9f)),
+                                         make_shared<op::v1::Multiply>(grad, scalar(shape, 0.1f)));
+            auto new_v = make_shared<op::v1::Add>(
+                make_shared<op::v1::Multiply>(v, scalar(shape, 0.999f)),
+                make_shared<op::v1::Multiply>(make_shared<op::v1::Multiply>(grad, grad),
+                                              scalar(shape, 0.001f)));
+            auto denom = make_shared<op::v1::Add>(make_shared<op::v0::Sqrt>(new_v),
+                                                  scalar(shape, 1e-8f));
+            auto new_param = make_shared<op::v1::Subtract>(
+                param,
+                make_shared<op::v1::Multiply>(scalar(shape, 0.01f),
+                                              make_shared<op::v1::Divide>(new_m, denom)));
+            outputs.insert(outputs.end(), {new_param, new_m, new_v});
+            params.insert(params.end(), {param, grad, m, v});
+        }
+        return make_shared<Function>(outputs, params);
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+    // The two Adam updates are merged, the SGD update stays on its own
+    ASSERT_EQ(count_ops_of_type<op::OptimizerUpdate>(cpu_f), 2);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_optimizer_update_lamb)
+{
+    Shape shape{50000};
+    ParameterVector params;
+    for (size_t i = 0; i < 4; i++)
+    {
+        params.push_back(make_shared<op::v0::Parameter>(element::f32, shape));
+    }
+    const float lr = 0.01f, beta1 = 0.9f, beta2 = 0.999f, eps = 1e-6f, wd = 0.01f;
+    auto update = make_shared<op::OptimizerUpdate>(
+        OutputVector{params[0], params[1], params[2], params[3]},
+        op::OptimizerUpdate::Algorithm::Lamb,
+        lr,
+        beta1,
+        beta2,
+        eps,
+        wd);
+    auto f = make_shared<Function>(update->outputs(), params);
+
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (size_t i = 0; i < 4; i++)
+    {
+        vector<float> tensor_val(shape_size(shape));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    vector<float> expected_param(shape_size(shape));
+    vector<float> expected_m(shape_size(shape));
+    vector<float> expected_v(shape_size(shape));
+    vector<float> step(shape_size(shape));
+    double param_norm = 0, step_norm = 0;
+    for (size_t i = 0; i < shape_size(shape); i++)
+    {
+        float g = args[1][i];
+        expected_m[i] = beta1 * args[2][i] + (1 - beta1) * g;
+        expected_v[i] = beta2 * args[3][i] + (1 - beta2) * g * g;
+        step[i] = expected_m[i] / (std::sqrt(expected_v[i]) + eps) + wd * args[0][i];
+        param_norm += args[0][i] * args[0][i];
+        step_norm += step[i] * step[i];
+    }
+    float trust = static_cast<float>(std::sqrt(param_norm) / std::sqrt(step_norm));
+    for (size_t i = 0; i < shape_size(shape); i++)
+    {
+        expected_param[i] = args[0][i] - lr * trust * step[i];
+    }
+
+    auto results = execute(f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(results.at(0), expected_param, 1.0e-5f, 1.0e-5f));
+    EXPECT_TRUE(test::all_close(results.at(1), expected_m, 1.0e-5f, 1.0e-5f));
+    EXPECT_TRUE(test::all_close(results.at(2), expected_v, 1.0e-5f, 1.0e-5f));
+}
+
 namespace
 {
     static void test_batchnorm_multiply_add_relu(const string& backend_name, Shape input_shape)
@@ -1465,6 +1639,141 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_convbias_affine_folding2)
     EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_matmul_affine_folding)
+{
+    auto make_function = []() {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape{4, 5});
+        auto weights = op::v0::Constant::create(
+            element::f32,
+            Shape{3, 5},
+            vector<float>{1, -2, 3, 0.5, 1, 0, 1, 2, -1, 3, 2, 2, -0.5, 1, 0});
+        auto bias = op::v0::Constant::create(element::f32, Shape{3}, vector<float>{0.5, -1, 2});
+        auto norm = [](vector<float> values) {
+            return op::v0::Constant::create(element::f32, Shape{3}, values);
+        };
+        // x . W^T + b, then batch norm, then a per-column scale and shift
+        auto dot = std::make_shared<op::v0::Dot>(
+            input, std::make_shared<op::v0::Reshape>(weights, AxisVector{1, 0}, Shape{5, 3}));
+        auto fc = std::make_shared<op::v1::Add>(
+            dot, std::make_shared<op::v0::Broadcast>(bias, Shape{4, 3}, AxisSet{0}));
+        auto bn = std::make_shared<op::v0::BatchNormInference>(fc,
+                                                               norm({1.5, 0.5, 2}),
+                                                               norm({0.1, 0.2, -0.3}),
+                                                               norm({1, -1, 0.5}),
+                                                               norm({4, 2, 0.25}),
+                                                               0.001);
+        auto scaled = std::make_shared<op::v1::Multiply>(
+            bn, std::make_shared<op::v0::Broadcast>(norm({2, -1, 0.5}), Shape{4, 3}, AxisSet{0}));
+        auto out = std::make_shared<op::v1::Add>(
+            scaled, std::make_shared<op::v0::Broadcast>(norm({1, 0, -1}), Shape{4, 3}, AxisSet{0}));
+        return make_shared<Function>(OutputVector{out}, ParameterVector{input});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_input_affine_folding)
+{
+    Shape shape_input{2, 3, 4, 4};
+    auto make_function = [shape_input]() {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape_input);
+        vector<float> filters(2 * 3 * 2 * 2);
+        for (size_t i = 0; i < filters.size(); i++)
+        {
+            filters[i] = 0.25f * static_cast<float>(i % 7) - 0.5f;
+        }
+        auto weights = op::v0::Constant::create(element::f32, Shape{2, 3, 2, 2}, filters);
+        auto scale = op::v0::Constant::create(element::f32, Shape{3}, vector<float>{0.5, 2, -1});
+        auto shift = op::v0::Constant::create(element::f32, Shape{3}, vector<float>{1, -0.25, 3});
+        auto affine = std::make_shared<op::v1::Add>(
+            std::make_shared<op::v1::Multiply>(
+                std::make_shared<op::v0::Broadcast>(scale, shape_input, AxisSet{0, 2, 3}), input),
+            std::make_shared<op::v0::Broadcast>(shift, shape_input, AxisSet{0, 2, 3}));
+        auto conv =
+            std::make_shared<op::v0::Convolution>(affine, weights, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(OutputVector{conv}, ParameterVector{input});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_broadcast_folding)
+{
+    Shape shape{2, 3, 4, 5};
+    auto make_function = [shape]() {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+        auto bias = std::make_shared<op::v0::Parameter>(element::f32, Shape{5});
+        auto scale = std::make_shared<op::v0::Parameter>(element::f32, Shape{3});
+        auto mask = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 5});
+        auto divisor = std::make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto floor = op::v0::Constant::create(element::f32, Shape{}, vector<float>{-0.5f});
+        auto row = std::make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto add = std::make_shared<op::v1::Add>(
+            input, std::make_shared<op::v0::Broadcast>(bias, shape, AxisSet{0, 1, 2}));
+        auto mul = std::make_shared<op::v1::Multiply>(
+            std::make_shared<op::v0::Broadcast>(scale, shape, AxisSet{0, 2, 3}), add);
+        auto sub = std::make_shared<op::v1::Subtract>(
+            mul, std::make_shared<op::v0::Broadcast>(mask, shape, AxisSet{1, 2}));
+        auto div = std::make_shared<op::v1::Divide>(
+            sub, std::make_shared<op::v0::Broadcast>(divisor, shape, AxisSet{2, 3}));
+        auto max = std::make_shared<op::v1::Maximum>(
+            div, std::make_shared<op::v0::Broadcast>(floor, shape, AxisSet{0, 1, 2, 3}));
+        // both sides broadcast
+        auto min = std::make_shared<op::v1::Minimum>(
+            std::make_shared<op::v0::Broadcast>(row, shape, AxisSet{0, 1, 3}),
+            std::make_shared<op::v0::Broadcast>(bias, shape, AxisSet{0, 1, 2}));
+        return make_shared<Function>(OutputVector{max, min},
+                                     ParameterVector{input, bias, scale, mask, divisor, row});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(1.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, batch_fusion_group_convolution)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -2149,6 +2458,64 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fuse_dropout)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fusions_before_strength_reduction)
+{
+    // Both divisors are powers of two, which StrengthReduction turns into multiplies by default
+    auto make_bn = []() {
+        Shape shape{2, 3, 2, 2};
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+        auto gamma = std::make_shared<op::v0::Parameter>(element::f32, Shape{3});
+        auto beta = std::make_shared<op::v0::Parameter>(element::f32, Shape{3});
+        auto eps = op::v0::Constant::create(element::f32, Shape{3}, {0.001f});
+        auto n = op::v0::Constant::create(element::f32, Shape{3}, {8});
+        AxisSet axes{0, 2, 3};
+
+        auto sum = std::make_shared<op::v0::Sum>(input, axes);
+        auto sum_sq =
+            std::make_shared<op::v0::Sum>(std::make_shared<op::v1::Multiply>(input, input), axes);
+        auto variance = std::make_shared<op::v1::Divide>(
+            std::make_shared<op::v1::Subtract>(
+                sum_sq,
+                std::make_shared<op::v1::Divide>(std::make_shared<op::v1::Multiply>(sum, sum),
+                                                 n)),
+            n);
+        auto mean =
+            std::make_shared<op::v1::Divide>(std::make_shared<op::v0::Sum>(input, axes), n);
+        auto centered = std::make_shared<op::v1::Subtract>(
+            input, std::make_shared<op::v0::Broadcast>(mean, shape, axes));
+        auto stddev = std::make_shared<op::v0::Sqrt>(std::make_shared<op::v1::Add>(
+            std::make_shared<op::v0::Broadcast>(eps, shape, axes),
+            std::make_shared<op::v0::Broadcast>(variance, shape, axes)));
+        auto scaled = std::make_shared<op::v1::Multiply>(
+            std::make_shared<op::v0::Broadcast>(gamma, shape, axes),
+            std::make_shared<op::v1::Divide>(centered, stddev));
+        auto bn = std::make_shared<op::v1::Add>(
+            std::make_shared<op::v0::Broadcast>(beta, shape, axes), scaled);
+        return make_shared<Function>(bn, ParameterVector{input, gamma, beta});
+    };
+
+    auto make_dropout = []() {
+        Shape shape{2, 2, 16, 16};
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+        auto keep = op::v0::Constant::create(element::f32, shape, {0.5});
+        auto one = op::v0::Constant::create(element::f32, Shape{}, {1});
+        auto mask =
+            std::make_shared<op::v0::GenerateMask>(one, shape, element::f32, 1, 0.5, false);
+        auto dropout = std::make_shared<op::v1::Divide>(
+            std::make_shared<op::v1::Multiply>(mask, input), keep);
+        return make_shared<Function>(OutputVector{dropout, mask}, ParameterVector{input});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto bn_f = make_bn();
+    backend->compile(bn_f);
+    EXPECT_EQ(count_ops_of_type<op::v0::BatchNormTraining>(bn_f), 1);
+
+    auto dropout_f = make_dropout();
+    backend->compile(dropout_f);
+    EXPECT_EQ(count_ops_of_type<op::Dropout>(dropout_f), 1);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fuse_leaky_relu)
 {
     auto make_function = [](Shape input_shape, vector<float> alpha_val) {
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -36,14 +37,22 @@
 #include "ngraph/op/tile.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/cached_attention.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_constant_hoisting.hpp"
+#include "ngraph/runtime/execution_profile.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/stack_functions.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
@@ -835,6 +844,83 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_memory_reuse_cacheable_no_destructive_oi_r
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_cacheable_input_version)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::v0::Relu>(make_shared<op::v1::Multiply>(A, A));
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(relu, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a1 = backend->create_tensor(element::f32, shape);
+    copy_data(a1, vector<float>{1, 2, 3, 4});
+    auto a2 = backend->create_tensor(element::f32, shape);
+    copy_data(a2, vector<float>{2, 2, 2, 2});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a1, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{2, 5, 10, 17}));
+
+    // Neither tensor is stale, but the cached intermediates were computed from a1
+    a1->set_stale(false);
+    a2->set_stale(false);
+    handle->call_with_validate({result}, {a2, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{5, 5, 5, 5}));
+    handle->call_with_validate({result}, {a2, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{5, 5, 5, 5}));
+
+    copy_data(a2, vector<float>{3, 3, 3, 3});
+    a2->set_stale(true);
+    handle->call_with_validate({result}, {a2, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{10, 10, 10, 10}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_cacheable_concurrent_contexts)
+{
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::v0::Relu>(make_shared<op::v1::Multiply>(A, A));
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(relu, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+
+    // Each thread binds its own cacheable input and the calls land on either context in
+    // any order. A context must never return intermediates cached from the other input.
+    auto make_calls = [&](float value) {
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), value));
+        auto result = backend->create_tensor(element::f32, shape);
+        vector<float> expected(shape_size(shape), value * value + 1);
+        for (size_t i = 0; i < 50; i++)
+        {
+            handle->call_with_validate({result}, {a, b});
+            a->set_stale(false);
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+        }
+    };
+
+    std::thread call1(make_calls, 2.0f);
+    std::thread call2(make_calls, 3.0f);
+    std::thread call3(make_calls, 4.0f);
+    call1.join();
+    call2.join();
+    call3.join();
+
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_memory_reuse_in_place_concat_after_in_place_slice)
 {
     Shape shape_a{4, 4};
@@ -1077,6 +1163,28 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_convertlayout)
     ASSERT_EQ(convert_layout, 1);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_strength_reduction_opt_in)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    Shape shape{2, 3};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto C = op::v0::Constant::create(element::f32, shape, vector<float>(6, 3.0f));
+        return make_shared<Function>(make_shared<op::v1::Divide>(A, C), ParameterVector{A});
+    };
+
+    // x / c -> x * (1 / c) rounds differently, so it only runs when asked for
+    auto exact_f = make_function();
+    backend->compile(exact_f);
+    EXPECT_EQ(count_ops_of_type<op::v1::Divide>(exact_f), 1);
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("StrengthReduction::Approximate", true);
+    auto approximate_f = make_function();
+    backend->compile(approximate_f, pass_config);
+    EXPECT_EQ(count_ops_of_type<op::v1::Divide>(approximate_f), 0);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_reshape)
 {
     // Initialize CPU constant folders
@@ -1132,6 +1240,367 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_reshape_permute)
     EXPECT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_hoisting)
+{
+    auto make_function = []() {
+        Shape shape_a{2, 3};
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto W = op::v0::Constant::create(
+            element::f32, Shape{4, 3}, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto S = op::v0::Constant::create(element::f32, Shape{4, 4}, vector<float>(16, 0.5f));
+        // Transposed and rescaled weights depend only on constants
+        auto transpose = make_shared<op::v0::Reshape>(W, AxisVector{1, 0}, Shape{3, 4});
+        auto weights = make_shared<op::v0::Dot>(transpose, S);
+        auto dot = make_shared<op::v0::Dot>(A, weights);
+        return make_shared<Function>(dot, ParameterVector{A});
+    };
+
+    auto f = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUConstantHoisting>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Dot>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Reshape>(f), 0);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_threaded_gather_scatter_nd)
+{
+    auto make_function = []() {
+        Shape params_shape{64, 16, 32};
+        Shape updates_shape{40, 32};
+        // Repeated index pairs make several updates land on the same slice
+        vector<int32_t> indices_val;
+        for (int32_t i = 0; i < 40; i++)
+        {
+            indices_val.push_back((i * 7) % 64);
+            indices_val.push_back(i % 3 == 0 ? -1 : i % 16);
+        }
+        auto P = make_shared<op::v0::Parameter>(element::f32, params_shape);
+        auto U = make_shared<op::v0::Parameter>(element::f32, updates_shape);
+        auto gather_indices = op::v0::Constant::create(element::i32, Shape{40, 2}, indices_val);
+        for (auto& index : indices_val)
+        {
+            index = index < 0 ? 15 : index;
+        }
+        auto scatter_indices = op::v0::Constant::create(element::i32, Shape{40, 2}, indices_val);
+        auto gather = make_shared<op::v0::GatherND>(P, gather_indices);
+        auto scatter = make_shared<op::v0::ScatterNDAdd>(P, scatter_indices, U);
+        return make_shared<Function>(OutputVector{gather, scatter}, ParameterVector{P, U});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    auto f = make_function();
+    for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_gather_scatter_nd_out_of_bounds)
+{
+    Shape params_shape{4, 3};
+    Shape indices_shape{2, 1};
+    auto P = make_shared<op::v0::Parameter>(element::f32, params_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i32, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto gather = make_shared<op::v0::GatherND>(P, I);
+    auto scatter = make_shared<op::v0::ScatterNDAdd>(P, I, U);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto p = backend->create_tensor(element::f32, params_shape);
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    auto u = backend->create_tensor(element::f32, Shape{2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(p, vector<float>(12, 1.0f));
+    copy_data(u, vector<float>(6, 1.0f));
+    auto gather_handle = backend->compile(make_shared<Function>(gather, ParameterVector{P, I}));
+    auto scatter_handle =
+        backend->compile(make_shared<Function>(scatter, ParameterVector{P, I, U}));
+    auto scatter_result = backend->create_tensor(element::f32, params_shape);
+
+    // Negative indices count from the end for GatherND only
+    copy_data(i, vector<int32_t>{3, -4});
+    gather_handle->call_with_validate({result}, {p, i});
+    EXPECT_ANY_THROW(scatter_handle->call_with_validate({scatter_result}, {p, i, u}));
+
+    copy_data(i, vector<int32_t>{0, 4});
+    EXPECT_ANY_THROW(gather_handle->call_with_validate({result}, {p, i}));
+    EXPECT_ANY_THROW(scatter_handle->call_with_validate({scatter_result}, {p, i, u}));
+
+    copy_data(i, vector<int32_t>{-5, 0});
+    EXPECT_ANY_THROW(gather_handle->call_with_validate({result}, {p, i}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_parallel_threshold)
+{
+    Shape small_shape{2};
+    Shape large_shape{1024, 1024};
+    auto A = make_shared<op::v0::Parameter>(element::f32, small_shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, small_shape);
+    auto C = make_shared<op::v0::Parameter>(element::f32, large_shape);
+    auto D = make_shared<op::v0::Parameter>(element::f32, large_shape);
+    auto small_add = make_shared<op::v1::Add>(A, B);
+    auto large_add = make_shared<op::v1::Add>(C, D);
+    auto f = make_shared<Function>(OutputVector{small_add, large_add},
+                                   ParameterVector{A, B, C, D});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, small_shape);
+    auto b = backend->create_tensor(element::f32, small_shape);
+    auto c = backend->create_tensor(element::f32, large_shape);
+    auto d = backend->create_tensor(element::f32, large_shape);
+    auto small_result = backend->create_tensor(element::f32, small_shape);
+    auto large_result = backend->create_tensor(element::f32, large_shape);
+    copy_data(a, vector<float>{1, 2});
+    copy_data(b, vector<float>{3, 4});
+    copy_data(c, vector<float>(shape_size(large_shape), 1.0f));
+    copy_data(d, vector<float>(shape_size(large_shape), 2.0f));
+
+    auto handle = backend->compile(f, true);
+    handle->call_with_validate({small_result, large_result}, {a, b, c, d});
+    EXPECT_EQ((vector<float>{4, 6}), read_vector<float>(small_result));
+    EXPECT_EQ(vector<float>(shape_size(large_shape), 3.0f), read_vector<float>(large_result));
+
+    size_t adds = 0;
+    for (auto& counter : handle->get_performance_data())
+    {
+        if (!is_type<op::v1::Add>(counter.get_node()))
+        {
+            continue;
+        }
+        adds++;
+        size_t bytes = 3 * shape_size(counter.get_node()->get_output_shape(0)) * sizeof(float);
+        EXPECT_EQ(counter.work_estimate(), bytes);
+        EXPECT_EQ(counter.is_serial(), bytes < counter.parallel_threshold());
+        if (counter.get_node()->get_output_shape(0) == large_shape)
+        {
+            // Calibrated thresholds are capped well below the size of this add
+            EXPECT_TRUE(getenv("NGRAPH_CPU_PARALLEL_THRESHOLD") || !counter.is_serial());
+        }
+    }
+    EXPECT_EQ(adds, 2);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_execution_profile)
+{
+    Shape shape{2, 3};
+    auto make_f = [shape] {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto add = make_shared<op::v1::Add>(A, B);
+        auto mul = make_shared<op::v1::Multiply>(add, B);
+        return make_shared<Function>(mul, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{2, 2, 2, 2, 2, 2});
+
+    auto handle = backend->compile(make_f(), true);
+    for (int i = 0; i < 3; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+        // Only a holds new data in the later calls
+        b->set_stale(false);
+    }
+    EXPECT_EQ((vector<float>{6, 8, 10, 12, 14, 16}), read_vector<float>(result));
+
+    auto profile = static_pointer_cast<runtime::cpu::CPU_Executable>(handle)->get_profile();
+    EXPECT_EQ(profile.get_call_count(), 3);
+    EXPECT_EQ(profile.get_input_change_counts(), (vector<size_t>{3, 1}));
+    auto perf_data = handle->get_performance_data();
+    ASSERT_EQ(profile.get_ops().size(), perf_data.size());
+    for (size_t i = 0; i < perf_data.size(); i++)
+    {
+        EXPECT_NE(profile.find(i, *perf_data[i].get_node()), nullptr);
+    }
+    auto other = make_shared<op::v1::Subtract>(make_shared<op::v0::Parameter>(element::f32, shape),
+                                               make_shared<op::v0::Parameter>(element::f32, shape));
+    EXPECT_EQ(profile.find(0, *other), nullptr);
+
+    auto path = file_util::path_join(file_util::get_temp_directory_path(),
+                                     "cpu_test_execution_profile.txt");
+    profile.save(path);
+    auto loaded = runtime::ExecutionProfile::load(path);
+    EXPECT_EQ(loaded.get_call_count(), profile.get_call_count());
+    EXPECT_EQ(loaded.get_input_change_counts(), profile.get_input_change_counts());
+    ASSERT_EQ(loaded.get_ops().size(), profile.get_ops().size());
+    for (size_t i = 0; i < profile.get_ops().size(); i++)
+    {
+        EXPECT_EQ(loaded.get_ops()[i].type, profile.get_ops()[i].type);
+        EXPECT_EQ(loaded.get_ops()[i].output_shapes, profile.get_ops()[i].output_shapes);
+        EXPECT_EQ(loaded.get_ops()[i].call_count, profile.get_ops()[i].call_count);
+        EXPECT_EQ(loaded.get_ops()[i].total_microseconds,
+                  profile.get_ops()[i].total_microseconds);
+        EXPECT_EQ(loaded.get_ops()[i].serial, profile.get_ops()[i].serial);
+    }
+
+    EXPECT_EQ(loaded.get_function_hash(), profile.get_function_hash());
+
+    // Compiling with the profile may move ops between the pool and the calling thread, but
+    // must not change results
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    pass::PassConfig pass_config;
+    auto profiled_handle = cpu_backend->compile(make_f(), pass_config, loaded);
+    profiled_handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{6, 8, 10, 12, 14, 16}), read_vector<float>(result));
+
+    // The ops are far too small for the pool, so they run on the calling thread unless a
+    // profile records them as much slower than a pool dispatch
+    vector<runtime::PerformanceCounter> slow_counters;
+    for (auto counter : perf_data)
+    {
+        EXPECT_TRUE(counter.is_serial());
+        counter.m_call_count = 1;
+        counter.m_total_microseconds = 1000000;
+        slow_counters.push_back(counter);
+    }
+    runtime::ExecutionProfile slow_profile(slow_counters);
+    auto slow_handle = cpu_backend->compile(make_f(), pass_config, slow_profile, true);
+    slow_handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{6, 8, 10, 12, 14, 16}), read_vector<float>(result));
+    if (runtime::cpu::executor::GetCPUExecutor().get_dispatch_nanoseconds() > 0)
+    {
+        for (auto& counter : slow_handle->get_performance_data())
+        {
+            EXPECT_FALSE(counter.is_serial()) << counter.get_node()->get_name();
+        }
+    }
+
+    // The profile is ignored by a function with other ops, and by a compile that is not given
+    // it
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto mul = make_shared<op::v1::Multiply>(make_shared<op::v1::Subtract>(A, B), B);
+    auto other_f = make_shared<Function>(mul, ParameterVector{A, B});
+    auto other_handle = cpu_backend->compile(other_f, pass_config, slow_profile, true);
+    other_handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{-2, 0, 2, 4, 6, 8}), read_vector<float>(result));
+    auto plain_handle = backend->compile(make_f(), true);
+    plain_handle->call_with_validate({result}, {a, b});
+    for (auto handle_without_profile : {other_handle, plain_handle})
+    {
+        for (auto& counter : handle_without_profile->get_performance_data())
+        {
+            EXPECT_TRUE(counter.is_serial()) << counter.get_node()->get_name();
+        }
+    }
+
+    {
+        ofstream out(path);
+        out << "not a profile\n";
+    }
+    EXPECT_THROW(runtime::ExecutionProfile::load(path), ngraph_error);
+    file_util::remove_file(path);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dead_output_sink)
+{
+    auto make_f = [] {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 100});
+        auto topk1 = make_shared<op::v0::TopK>(A, 1, element::i32, 5);
+        auto topk2 = make_shared<op::v0::TopK>(topk1->output(1), 1, element::i32, 2);
+        auto neg = make_shared<op::v0::Negative>(topk2->output(1));
+        return make_shared<Function>(neg, ParameterVector{A});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(400);
+    rng.initialize(a);
+    vector<vector<float>> args{a};
+
+    auto int_results = execute(make_f(), args, "INTERPRETER");
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_f = make_f();
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    auto handle = backend->compile(cpu_f, pass_config);
+
+    auto a_tensor = backend->create_tensor(element::f32, Shape{4, 100});
+    copy_data(a_tensor, a);
+    auto result = backend->create_tensor(element::f32, Shape{4, 2});
+    handle->call_with_validate({result}, {a_tensor});
+    EXPECT_TRUE(test::all_close(int_results.at(0), read_vector<float>(result)));
+
+    // The unused index outputs of both TopKs share one slot at the end of the pool, apart
+    // from the live values
+    vector<shared_ptr<Node>> topks;
+    for (auto node : cpu_f->get_ordered_ops())
+    {
+        if (is_type<op::v0::TopK>(node))
+        {
+            topks.push_back(node);
+        }
+    }
+    ASSERT_EQ(topks.size(), 2);
+    auto offset = [](const shared_ptr<Node>& n, size_t i) {
+        return n->output(i).get_tensor().get_pool_offset();
+    };
+    EXPECT_EQ(offset(topks[0], 0), offset(topks[1], 0));
+    EXPECT_GT(offset(topks[0], 0), offset(topks[0], 1));
+    EXPECT_GT(offset(topks[0], 0), offset(topks[1], 1));
+    EXPECT_LT(cpu_f->get_temporary_pool_size(), 4 * size_t(4096));
+}
+
+#ifdef NGRAPH_TBB_ENABLE
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dead_output_sink_tbb)
+{
+    bool use_tbb = getenv_bool("NGRAPH_CPU_USE_TBB");
+    if (!use_tbb)
+    {
+        set_environment("NGRAPH_CPU_USE_TBB", "1", 1);
+    }
+
+    // Independent TopKs may run at once in the flow graph
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 100});
+    auto topk1 = make_shared<op::v0::TopK>(A, 1, element::i32, 5);
+    auto topk2 = make_shared<op::v0::TopK>(A, 1, element::i32, 2);
+    auto f = make_shared<Function>(OutputVector{topk1->output(1), topk2->output(1)},
+                                   ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    backend->compile(f, pass_config);
+
+    // Each gets its own aligned slot of the sink for its unused indices
+    auto indices1 = topk1->output(0).get_tensor().get_pool_offset();
+    auto indices2 = topk2->output(0).get_tensor().get_pool_offset();
+    EXPECT_EQ(max(indices1, indices2) - min(indices1, indices2), 4096);
+
+    if (!use_tbb)
+    {
+        unset_environment("NGRAPH_CPU_USE_TBB");
+    }
+}
+#endif // NGRAPH_TBB_ENABLE
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_broadcast)
 {
     // Initialize CPU constant folders
@@ -2216,6 +2685,79 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_convolution_simple_bf16)
               read_vector<bfloat16>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_stack_functions_in_place)
+{
+    auto make_model = [](float weight) {
+        auto x = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto w = op::v0::Constant::create(element::f32, Shape{3, 2}, vector<float>(6, weight));
+        auto dot = make_shared<op::v0::Dot>(make_shared<op::v1::Multiply>(x, x), w);
+        return make_shared<Function>(dot, ParameterVector{x});
+    };
+    auto f = stack_functions({make_model(1), make_model(2)});
+    auto ref_f = clone_function(*f);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->compile(f);
+
+    // The stacked Dot reads and writes the stacked buffers without copies
+    size_t in_place_ops = 0;
+    for (auto node : f->get_ops())
+    {
+        if (is_type<op::v0::Concat>(node) || is_type<op::v0::Slice>(node))
+        {
+            auto annotations = static_pointer_cast<op::Op>(node)->get_op_annotations();
+            ASSERT_TRUE(annotations && !annotations->get_in_place_oi_pairs().empty())
+                << node->get_name() << " is not in place";
+            in_place_ops++;
+        }
+    }
+    EXPECT_EQ(in_place_ops, 3);
+
+    compare_backends(f, ref_f, "${BACKEND_NAME}", "INTERPRETER");
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_mixed_precision_bf16)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2, 1, 1});
+    auto W = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3});
+    auto conv = make_shared<op::v0::Convolution>(A,
+                                                 B,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+    auto pool =
+        make_shared<op::v0::MaxPool>(conv, Shape{2, 2}, Strides{2, 2}, Shape{0, 0}, Shape{0, 0});
+    auto reshape = make_shared<op::v0::Reshape>(pool, AxisVector{0, 1, 2, 3}, Shape{2, 4});
+    auto dot = make_shared<op::v0::Dot>(reshape, W);
+    auto f = make_shared<Function>(dot, ParameterVector{A, B, W});
+    auto ref_f = clone_function(*f);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>(
+        element::bf16, [&backend](const Node& node) { return backend->is_supported(node); });
+    pass_manager.run_passes(f);
+
+    // Only the DNNL convolution and pooling have bf16 kernels; Reshape and Dot stay in f32
+    bool bf16_supported = runtime::cpu::dnnl_utils::is_bf16_supported();
+    for (auto node : f->get_ops())
+    {
+        if (is_type<op::v0::Convolution>(node) || is_type<op::v0::MaxPool>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0) == element::bf16, bf16_supported);
+        }
+        else if (is_type<op::v0::Reshape>(node) || is_type<op::v0::Dot>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f32);
+        }
+    }
+
+    compare_backends(f, ref_f, "${BACKEND_NAME}", "INTERPRETER", 2e-2f, 2e-2f);
+}
+
 // This tests a backend's implementation of the three parameter version of create_tensor
 // Testing using this tensor as a Function input
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_create_tensor_2_input)
@@ -2300,6 +2842,163 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_tensorview_custom_mem)
     EXPECT_TRUE(test::all_close_f((vector<float>{2, 2, 2, 2}), rv, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_deterministic_reductions)
+{
+    // Reduced extents above the 1024 element block size so that slices span several blocks
+    Shape shape_a{3, 1500, 4};
+    Shape shape_b{2, 3, 4};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape_b);
+        return make_shared<Function>(
+            OutputVector{make_shared<op::v0::Sum>(A, AxisSet{1}),
+                         make_shared<op::v0::Sum>(A, AxisSet{0, 2}),
+                         make_shared<op::v0::Sum>(A, AxisSet{0, 1, 2}),
+                         make_shared<op::v0::Max>(A, AxisSet{0, 1}),
+                         make_shared<op::v0::Min>(A, AxisSet{0}),
+                         make_shared<op::v0::Product>(B, AxisSet{0, 2}),
+                         make_shared<op::v0::Softmax>(A, AxisSet{1})},
+            ParameterVector{A, B});
+    };
+
+    test::Uniform<float> rng_a(0.0f, 1.0f);
+    test::Uniform<float> rng_b(0.9f, 1.1f);
+    vector<float> a(shape_size(shape_a));
+    vector<float> b(shape_size(shape_b));
+    rng_a.initialize(a);
+    rng_b.initialize(b);
+    vector<vector<float>> args{a, b};
+
+    set_environment("NGRAPH_CPU_DETERMINISTIC", "1", 1);
+    auto cpu_results = execute(make_function(), args, "${BACKEND_NAME}");
+    auto cpu_rerun_results = execute(make_function(), args, "${BACKEND_NAME}");
+    unset_environment("NGRAPH_CPU_DETERMINISTIC");
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+
+    ASSERT_EQ(cpu_results.size(), int_results.size());
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        EXPECT_EQ(cpu_results.at(i), cpu_rerun_results.at(i));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_shared_memory_arena)
+{
+    runtime::cpu::SharedMemoryArena arena(runtime::get_default_allocator(), 64);
+    EXPECT_EQ(arena.acquire(0), nullptr);
+
+    auto small = arena.acquire(128);
+    auto large = arena.acquire(1024);
+    EXPECT_NE(small, large);
+    EXPECT_EQ(arena.get_reserved_size(), 128 + 1024);
+
+    // Idle buffers are reused best fit first
+    arena.release(small);
+    arena.release(large);
+    EXPECT_EQ(arena.acquire(100), small);
+    arena.release(small);
+
+    // An idle buffer that is too small is grown rather than a new one added
+    auto first = arena.acquire(1024);
+    auto grown = arena.acquire(4096);
+    EXPECT_EQ(first, large);
+    EXPECT_GE(grown->size(), size_t(4096));
+    EXPECT_EQ(arena.get_reserved_size(), 1024 + 4096);
+    arena.release(first);
+    arena.release(grown);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_shared_memory_pool)
+{
+    set_environment("NGRAPH_CPU_SHARED_MEMORY_POOL", "1", 1);
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto sum = make_shared<op::v1::Add>(A, B);
+        auto product = make_shared<op::v1::Multiply>(sum, B);
+        return make_shared<Function>(make_shared<op::v1::Subtract>(product, A),
+                                     ParameterVector{A, B});
+    };
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result1 = backend->create_tensor(element::f32, shape);
+    auto result2 = backend->create_tensor(element::f32, shape);
+
+    // Two executables borrowing from the same arena in turn, with unchanged inputs on
+    // the second round so stale input caching would be exercised
+    auto handle1 = backend->compile(make_function());
+    auto handle2 = backend->compile(make_function());
+    for (int i = 0; i < 2; i++)
+    {
+        handle1->call_with_validate({result1}, {a, b});
+        handle2->call_with_validate({result2}, {a, b});
+        EXPECT_TRUE(test::all_close_f((vector<float>{29, 46, 67, 92}),
+                                      read_vector<float>(result1),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+        EXPECT_TRUE(test::all_close_f((vector<float>{29, 46, 67, 92}),
+                                      read_vector<float>(result2),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+    unset_environment("NGRAPH_CPU_SHARED_MEMORY_POOL");
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_shared_memory_pool_allocator)
+{
+    class CountingAllocator : public runtime::Allocator
+    {
+    public:
+        void* malloc(size_t size, size_t alignment) override
+        {
+            m_allocations++;
+            return runtime::get_default_allocator()->malloc(size, alignment);
+        }
+        void free(void* ptr) override { runtime::get_default_allocator()->free(ptr); }
+        size_t m_allocations = 0;
+    };
+    // Buffers stay in the arena after the test, so the allocator must outlive it
+    static CountingAllocator* allocator = new CountingAllocator;
+
+    auto& arena = runtime::cpu::SharedMemoryArena::get_instance(allocator);
+    EXPECT_EQ(&arena, &runtime::cpu::SharedMemoryArena::get_instance(allocator));
+    EXPECT_NE(&arena, &runtime::cpu::SharedMemoryArena::get_instance(nullptr));
+
+    set_environment("NGRAPH_CPU_SHARED_MEMORY_POOL", "1", 1);
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    backend->set_host_memory_allocator(allocator);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto product = make_shared<op::v1::Multiply>(make_shared<op::v1::Add>(A, B), B);
+    auto f = make_shared<Function>(make_shared<op::v1::Subtract>(product, A),
+                                   ParameterVector{A, B});
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    // The intermediate pool is borrowed from the arena of the backend's allocator
+    size_t allocations = allocator->m_allocations;
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{29, 46, 67, 92}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_GT(allocator->m_allocations, allocations);
+    EXPECT_GT(arena.get_reserved_size(), 0);
+
+    backend->set_host_memory_allocator(nullptr);
+    unset_environment("NGRAPH_CPU_SHARED_MEMORY_POOL");
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_one_hot_scalar_oob_in_3)
 {
     Shape shape_a{};
@@ -2320,3 +3019,79 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_cached_attention)
+{
+    Shape shape{2, 1, 1};
+    auto Q = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto K = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto V = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto attention = make_shared<op::CachedAttention>(Q, K, V, 3, 1.0f);
+    auto f = make_shared<Function>(attention, ParameterVector{Q, K, V});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto q = backend->create_tensor(element::f32, shape);
+    auto k = backend->create_tensor(element::f32, shape);
+    auto v = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+
+    // The first sequence attends with weights exp(key), the second uniformly
+    copy_data(q, vector<float>{1, 0});
+    vector<vector<float>> keys{{0, 0}, {log(3.0f), 0}, {0, 0}};
+    vector<vector<float>> values{{2, 1}, {4, 1}, {9, 1}};
+    vector<vector<float>> expected{{2, 1}, {3.5f, 1}, {4.6f, 1}};
+    for (size_t step = 0; step < keys.size(); step++)
+    {
+        copy_data(k, keys[step]);
+        copy_data(v, values[step]);
+        handle->call_with_validate({result}, {q, k, v});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected[step]));
+    }
+    // The cache holds three positions
+    EXPECT_ANY_THROW(handle->call_with_validate({result}, {q, k, v}));
+
+    handle->reset_state();
+    copy_data(v, vector<float>{6, 5});
+    handle->call_with_validate({result}, {q, k, v});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{6, 5}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_cached_attention_prefill_decode)
+{
+    // Room for a two position prompt, then single positions
+    Shape shape{1, 2, 1};
+    auto Q = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto K = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto V = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto P = make_shared<op::v0::Parameter>(element::i32, Shape{});
+    auto attention = make_shared<op::CachedAttention>(Q, K, V, P, 4, 1.0f);
+    auto f = make_shared<Function>(attention, ParameterVector{Q, K, V, P});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto q = backend->create_tensor(element::f32, shape);
+    auto k = backend->create_tensor(element::f32, shape);
+    auto v = backend->create_tensor(element::f32, shape);
+    auto p = backend->create_tensor(element::i32, Shape{});
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+
+    // Prefill: the second position weighs the keys 1:3
+    copy_data(q, vector<float>{0, 1});
+    copy_data(k, vector<float>{0, log(3.0f)});
+    copy_data(v, vector<float>{2, 6});
+    copy_data(p, vector<int32_t>{2});
+    handle->call_with_validate({result}, {q, k, v, p});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{2, 5}));
+
+    // Decode with the same executable: only the first position is used, the second is junk
+    copy_data(q, vector<float>{0, 100});
+    copy_data(k, vector<float>{0, 100});
+    copy_data(v, vector<float>{7, 100});
+    copy_data(p, vector<int32_t>{1});
+    handle->call_with_validate({result}, {q, k, v, p});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{5, 0}));
+
+    copy_data(p, vector<int32_t>{3});
+    EXPECT_ANY_THROW(handle->call_with_validate({result}, {q, k, v, p}));
+}
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/autodiff/loss_scaling.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(mixed_precision, dot_relu_chain)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto W = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+    auto dot = make_shared<op::v0::Dot>(A, W);
+    auto relu = make_shared<op::v0::Relu>(dot);
+    auto f = make_shared<Function>(relu, ParameterVector{A, W});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    // Narrowing A and W, widening the Relu; the cast between Dot and Relu is cancelled
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(f), 3);
+    auto new_relu = f->get_results().at(0)->get_argument(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::v0::Relu>(new_relu));
+    EXPECT_EQ(new_relu->get_output_element_type(0), element::bf16);
+    EXPECT_EQ(new_relu->get_argument(0)->get_output_element_type(0), element::bf16);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+    EXPECT_EQ(A->get_element_type(), element::f32);
+    EXPECT_EQ(W->get_element_type(), element::f32);
+}
+
+TEST(mixed_precision, unsafe_ops_stay_f32)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto exp = make_shared<op::v0::Exp>(A);
+    auto sum = make_shared<op::v0::Sum>(exp, AxisSet{1});
+    auto f = make_shared<Function>(sum, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+}
+
+TEST(mixed_precision, unscale_gradients_overflow)
+{
+    auto G = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto scale = make_shared<op::v0::Parameter>(element::f32, Shape{});
+    auto outputs = autodiff::unscale_gradients(OutputVector{G}, scale);
+    ASSERT_EQ(outputs.size(), 2);
+    auto f = make_shared<Function>(outputs, ParameterVector{G, scale});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto g = backend->create_tensor(element::f32, Shape{4});
+    auto s = backend->create_tensor(element::f32, Shape{});
+    auto unscaled = backend->create_tensor(element::f32, Shape{4});
+    auto finite = backend->create_tensor(element::boolean, Shape{});
+    auto handle = backend->compile(f);
+
+    copy_data(s, vector<float>{4});
+    copy_data(g, vector<float>{4, 8, -12, 16});
+    handle->call_with_validate({unscaled, finite}, {g, s});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1, 2, -3, 4}, read_vector<float>(unscaled)));
+    EXPECT_EQ(read_vector<char>(finite), vector<char>{1});
+
+    copy_data(g, vector<float>{4, numeric_limits<float>::infinity(), -12, 16});
+    handle->call_with_validate({unscaled, finite}, {g, s});
+    EXPECT_EQ(read_vector<char>(finite), vector<char>{0});
+
+    copy_data(g, vector<float>{4, 8, -numeric_limits<float>::infinity(), 16});
+    handle->call_with_validate({unscaled, finite}, {g, s});
+    EXPECT_EQ(read_vector<char>(finite), vector<char>{0});
+
+    copy_data(g, vector<float>{4, 8, -12, numeric_limits<float>::quiet_NaN()});
+    handle->call_with_validate({unscaled, finite}, {g, s});
+    EXPECT_EQ(read_vector<char>(finite), vector<char>{0});
+}
+
+TEST(mixed_precision, dynamic_loss_scaler)
+{
+    autodiff::DynamicLossScaler scaler(1024.0f, 2.0f, 0.5f, 2);
+    EXPECT_FALSE(scaler.update(false));
+    EXPECT_EQ(scaler.get_scale(), 512.0f);
+    EXPECT_TRUE(scaler.update(true));
+    EXPECT_EQ(scaler.get_scale(), 512.0f);
+    EXPECT_TRUE(scaler.update(true));
+    EXPECT_EQ(scaler.get_scale(), 1024.0f);
+}
@@ -649,3 +649,104 @@ func @argmax_uint(%arg0: !ng.tensor<4x3xui32>) -> !ng.tensor<3xsi32> {
    %0 = "ng.argmax.red"(%arg0) {axes = [0]} : (!ng.tensor<4x3xui32>) -> !ng.tensor<3xsi32>
    "ng.return"(%0) : (!ng.tensor<3xsi32>) -> ()
 }
+
+// -----
+
+// Exp Op
+// CHECK-LABEL: func @simple_exp
+//      CHECK:  affine.for %[[I:.*]] = 0 to 2
+// CHECK-NEXT:    affine.for %[[J:.*]] = 0 to 2
+// CHECK-NEXT:      %[[ARG:.*]] = affine.load %{{.*}}[%[[I]], %[[J]]] : memref<2x2xf32>
+// CHECK-NEXT:      %[[RES:.*]] = exp %[[ARG]] : f32
+// CHECK-NEXT:      affine.store %[[RES]], %{{.*}}[%[[I]], %[[J]]]
+func @simple_exp(%arg0: !ng.tensor<2x2xf32>) -> !ng.tensor<2x2xf32> {
+  %0 = "ng.exp"(%arg0) : (!ng.tensor<2x2xf32>) -> !ng.tensor<2x2xf32>
+  "ng.return"(%0) : (!ng.tensor<2x2xf32>) -> ()
+}
+
+// -----
+
+// Tanh Op is expanded into a rational approximation without calls
+// CHECK-LABEL: func @simple_tanh
+//      CHECK:  affine.for %[[I:.*]] = 0 to 8
+//  CHECK-NOT:    call
+//      CHECK:    divf
+//      CHECK:    select
+//      CHECK:    affine.store
+func @simple_tanh(%arg0: !ng.tensor<8xf32>) -> !ng.tensor<8xf32> {
+  %0 = "ng.tanh"(%arg0) : (!ng.tensor<8xf32>) -> !ng.tensor<8xf32>
+  "ng.return"(%0) : (!ng.tensor<8xf32>) -> ()
+}
+
+// -----
+
+// Sigmoid Op
+// CHECK-LABEL: func @simple_sigmoid
+//      CHECK:  affine.for %[[I:.*]] = 0 to 8
+//      CHECK:    %[[NEG:.*]] = subf
+// CHECK-NEXT:    %[[EXP:.*]] = exp %[[NEG]] : f32
+// CHECK-NEXT:    %[[DEN:.*]] = addf %{{.*}}, %[[EXP]] : f32
+// CHECK-NEXT:    %[[RES:.*]] = divf %{{.*}}, %[[DEN]] : f32
+// CHECK-NEXT:    affine.store %[[RES]], %{{.*}}[%[[I]]]
+func @simple_sigmoid(%arg0: !ng.tensor<8xf32>) -> !ng.tensor<8xf32> {
+  %0 = "ng.sigmoid"(%arg0) : (!ng.tensor<8xf32>) -> !ng.tensor<8xf32>
+  "ng.return"(%0) : (!ng.tensor<8xf32>) -> ()
+}
+
+// -----
+
+// Select Op
+// CHECK-LABEL: func @simple_select
+//      CHECK:  affine.for %[[I:.*]] = 0 to 4
+// CHECK-NEXT:    %[[PRED:.*]] = affine.load %{{.*}}[%[[I]]] : memref<4xi8>
+//      CHECK:    %[[CMP:.*]] = cmpi "ne", %[[PRED]], %{{.*}} : i8
+//      CHECK:    %[[RES:.*]] = select %[[CMP]], %{{.*}}, %{{.*}} : f32
+// CHECK-NEXT:    affine.store %[[RES]], %{{.*}}[%[[I]]]
+func @simple_select(%arg0: !ng.tensor<4x!ng.u8>, %arg1: !ng.tensor<4xf32>, %arg2: !ng.tensor<4xf32>) -> !ng.tensor<4xf32> {
+  %0 = "ng.select"(%arg0, %arg1, %arg2) : (!ng.tensor<4x!ng.u8>, !ng.tensor<4xf32>, !ng.tensor<4xf32>) -> !ng.tensor<4xf32>
+  "ng.return"(%0) : (!ng.tensor<4xf32>) -> ()
+}
+
+// -----
+
+// Broadcast Op
+// CHECK-LABEL: func @simple_broadcast
+//      CHECK:  affine.for %[[I:.*]] = 0 to 2
+// CHECK-NEXT:    affine.for %[[J:.*]] = 0 to 3
+// CHECK-NEXT:      %[[ARG:.*]] = affine.load %{{.*}}[%[[J]]] : memref<3xf32>
+// CHECK-NEXT:      affine.store %[[ARG]], %{{.*}}[%[[I]], %[[J]]] : memref<2x3xf32>
+func @simple_broadcast(%arg0: !ng.tensor<3xf32>) -> !ng.tensor<2x3xf32> {
+  %0 = "ng.broadcast"(%arg0) {axisSet = [0], shape = [2, 3]} : (!ng.tensor<3xf32>) -> !ng.tensor<2x3xf32>
+  "ng.return"(%0) : (!ng.tensor<2x3xf32>) -> ()
+}
+
+// -----
+
+// Transposing Reshape Op
+// CHECK-LABEL: func @transpose_reshape
+//      CHECK:  affine.for %[[I:.*]] = 0 to 3
+// CHECK-NEXT:    affine.for %[[J:.*]] = 0 to 2
+//      CHECK:      %[[ARG:.*]] = affine.load %{{.*}}[{{.*}}] : memref<2x3xf32>
+// CHECK-NEXT:      affine.store %[[ARG]], %{{.*}}[%[[I]], %[[J]]] : memref<3x2xf32>
+func @transpose_reshape(%arg0: !ng.tensor<2x3xf32>) -> !ng.tensor<3x2xf32> {
+  %0 = "ng.reshape"(%arg0) {axisOrder = [1, 0], shape = [3, 2]} : (!ng.tensor<2x3xf32>) -> !ng.tensor<3x2xf32>
+  "ng.return"(%0) : (!ng.tensor<3x2xf32>) -> ()
+}
+
+// -----
+
+// Sum reduction
+// CHECK-LABEL: func @sum_red
+//      CHECK:  affine.for %[[COL:.*]] = 0 to 3
+// CHECK-NEXT:    %[[ZERO:.*]] = constant 0.000000e+00 : f32
+// CHECK-NEXT:    affine.store %[[ZERO]], %{{.*}}[%[[COL]]] : memref<3xf32>
+//      CHECK:  affine.for %[[ROW:.*]] = 0 to 4
+// CHECK-NEXT:    affine.for %[[COL:.*]] = 0 to 3
+// CHECK-NEXT:      %[[ACC:.*]] = affine.load %{{.*}}[%[[COL]]] : memref<3xf32>
+// CHECK-NEXT:      %[[VAL:.*]] = affine.load %{{.*}}[%[[ROW]], %[[COL]]] : memref<4x3xf32>
+// CHECK-NEXT:      %[[SUM:.*]] = addf %[[ACC]], %[[VAL]] : f32
+// CHECK-NEXT:      affine.store %[[SUM]], %{{.*}}[%[[COL]]] : memref<3xf32>
+func @sum_red(%arg0: !ng.tensor<4x3xf32>) -> !ng.tensor<3xf32> {
+  %0 = "ng.sum.red"(%arg0) {axes = [0]} : (!ng.tensor<4x3xf32>) -> !ng.tensor<3xf32>
+  "ng.return"(%0) : (!ng.tensor<3xf32>) -> ()
+}
@@ -0,0 +1,21 @@
+// RUN: ngraph-opt %s -convert-ngraph-to-affine -ngraph-affine-parallel-outlining | FileCheck %s
+
+// Verify that outermost parallel loops are outlined and replaced by a call covering
+// their whole iteration space, and that the outlined body records its iteration cost.
+
+// CHECK-LABEL: func @simple_add
+//   CHECK-NOT: affine.for
+//       CHECK: call @__ngraph_parallel_body_0({{.*}}) : (index, index, memref<8x4xf32>, memref<8x4xf32>, memref<8x4xf32>) -> ()
+// CHECK-LABEL: func @__ngraph_parallel_body_0
+//  CHECK-SAME: (%[[B:.*]]: index, %[[E:.*]]: index
+//  CHECK-SAME: attributes {ngraph.iteration_cost = {{[0-9]+}} : i64}
+//       CHECK: affine.for %[[K:.*]] = %[[B]] to %[[E]] {
+//       CHECK:   %[[I:.*]] = affine.apply #{{.*}}(%[[K]])
+//       CHECK:   affine.for %[[J:.*]] = 0 to 4 {
+//       CHECK:     affine.load %{{.*}}[%[[I]], %[[J]]] : memref<8x4xf32>
+//       CHECK:     addf
+//       CHECK:     affine.store
+func @simple_add(%arg0: !ng.tensor<8x4xf32>, %arg1: !ng.tensor<8x4xf32>) -> !ng.tensor<8x4xf32> {
+  %0 = "ng.add"(%arg0, %arg1) : (!ng.tensor<8x4xf32>, !ng.tensor<8x4xf32>) -> !ng.tensor<8x4xf32>
+  "ng.return"(%0) : (!ng.tensor<8x4xf32>) -> ()
+}
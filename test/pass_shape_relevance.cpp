@@ -24,6 +24,8 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
+#include "ngraph/runtime/dynamic/shape_program.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -176,3 +178,64 @@ TEST(shape_relevance, param_shape_of_indirect_i32_v3)
 
     ASSERT_FALSE(param0->is_relevant_to_shapes());
 }
+
+TEST(shape_relevance, shape_program)
+{
+    auto param0 = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto param1 = make_shared<op::v0::Parameter>(element::i64, Shape{1});
+
+    auto s = make_shared<op::v3::ShapeOf>(param0);
+    auto g = make_shared<op::v1::Gather>(s,
+                                         op::v0::Constant::create(element::i64, Shape{1}, {1}),
+                                         op::v0::Constant::create(element::i64, Shape{}, {0}));
+    auto c = make_shared<op::v0::Concat>(OutputVector{g, param1}, 0);
+    auto x = make_shared<op::v1::Reshape>(param0, c, false);
+
+    auto f = make_shared<Function>(x, ParameterVector{param0, param1});
+
+    pass::Manager manager;
+    manager.register_pass<pass::ShapeRelevance>();
+    manager.run_passes(f);
+
+    runtime::dynamic::ShapeProgram program(f);
+    ASSERT_TRUE(program.is_valid());
+
+    auto t0 = make_shared<runtime::HostTensor>(element::f32, Shape{4, 6});
+    auto t1 = make_shared<runtime::HostTensor>(element::i64, Shape{1});
+    vector<int64_t> v1{4};
+    t1->write(v1.data(), v1.size() * sizeof(int64_t));
+
+    vector<int64_t> key{-1};
+    ASSERT_TRUE(program.evaluate({t0, t1}, key));
+    EXPECT_EQ(key, (vector<int64_t>{-1, 1, 2, 6, 4}));
+
+    // Values past the range of int must not collide with small ones
+    v1[0] = 4 + (int64_t(1) << 32);
+    t1->write(v1.data(), v1.size() * sizeof(int64_t));
+    vector<int64_t> wide_key{-1};
+    ASSERT_TRUE(program.evaluate({t0, t1}, wide_key));
+    EXPECT_EQ(wide_key, (vector<int64_t>{-1, 1, 2, 6, v1[0]}));
+}
+
+TEST(shape_relevance, shape_program_feeds_data)
+{
+    auto param0 = make_shared<op::v0::Parameter>(element::f32, Shape{4, 6});
+    auto param1 = make_shared<op::v0::Parameter>(element::i64, Shape{2});
+    auto x = make_shared<op::v1::Reshape>(param0, param1, true);
+    auto y = make_shared<op::v0::Convert>(param1, element::f32);
+
+    auto f = make_shared<Function>(OutputVector{x, y}, ParameterVector{param0, param1});
+
+    pass::Manager manager;
+    manager.register_pass<pass::ShapeRelevance>();
+    manager.run_passes(f);
+
+    runtime::dynamic::ShapeProgram program(f);
+    ASSERT_FALSE(program.is_valid());
+
+    auto t0 = make_shared<runtime::HostTensor>(element::f32, Shape{4, 6});
+    auto t1 = make_shared<runtime::HostTensor>(element::i64, Shape{2});
+    vector<int64_t> key;
+    ASSERT_FALSE(program.evaluate({t0, t1}, key));
+    EXPECT_TRUE(key.empty());
+}
@@ -48,7 +48,7 @@ using namespace std;
 
 TEST(reshape_sinking, edge_splitting)
 {
-    // checks if Reshapes are pushed through op::v0::Abs, but stopped by Sum
+    // checks if Reshapes are pushed through op::v0::Abs and into Sum
     Shape shape_nhwc{16, 28, 28, 1};
     Shape shape_nchw{16, 1, 28, 28};
     auto a = make_shared<op::v0::Parameter>(element::i32, shape_nhwc);
@@ -64,6 +64,7 @@ TEST(reshape_sinking, edge_splitting)
     pass_manager.register_pass<pass::CommonSubexpressionElimination>();
     pass_manager.run_passes(func);
     ASSERT_EQ(func->get_results().at(1)->get_argument(0), sum);
+    ASSERT_EQ(sum->get_argument(0), a);
     auto new_reshape = as_type_ptr<op::v0::Reshape>(func->get_results().at(0)->get_argument(0));
     ASSERT_TRUE(new_reshape);
     ASSERT_EQ(new_reshape->get_output_shape(0), shape_nchw);
@@ -270,6 +271,60 @@ TEST(reshape_sinking, concat)
     ASSERT_LE(before_after, before_count);
 }
 
+TEST(reshape_sinking, reduction)
+{
+    Shape shape_nhwc{2, 4, 6, 3};
+    Shape shape_nchw{2, 3, 4, 6};
+    auto a = make_shared<op::v0::Parameter>(element::f32, shape_nhwc);
+    auto reshape = make_shared<op::v0::Reshape>(a, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto sum_hw = make_shared<op::v0::Sum>(reshape, AxisSet{2, 3});
+    auto max_w = make_shared<op::v0::Max>(reshape, AxisSet{3});
+    auto func = make_shared<Function>(OutputVector{sum_hw, max_w}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeSinking>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(func);
+
+    // reducing H and W leaves N and C in order
+    ASSERT_EQ(func->get_results().at(0)->get_argument(0), sum_hw);
+    ASSERT_EQ(sum_hw->get_argument(0), a);
+    ASSERT_EQ(sum_hw->get_reduction_axes(), (AxisSet{1, 2}));
+    ASSERT_EQ(sum_hw->get_output_shape(0), (Shape{2, 3}));
+
+    // reducing W leaves the smaller NHC result to transpose
+    auto new_reshape = as_type_ptr<op::v0::Reshape>(func->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(new_reshape);
+    ASSERT_EQ(new_reshape->get_input_order(), (AxisVector{0, 2, 1}));
+    ASSERT_EQ(new_reshape->get_output_shape(0), (Shape{2, 3, 4}));
+    ASSERT_EQ(new_reshape->get_argument(0), max_w);
+    ASSERT_EQ(max_w->get_argument(0), a);
+    ASSERT_EQ(max_w->get_reduction_axes(), (AxisSet{2}));
+}
+
+TEST(reshape_sinking, cost_model)
+{
+    // sinking the transpose past both users would replicate it
+    Shape shape_nhwc{2, 4, 6, 3};
+    Shape shape_nchw{2, 3, 4, 6};
+    auto a = make_shared<op::v0::Parameter>(element::f32, shape_nhwc);
+    auto reshape = make_shared<op::v0::Reshape>(a, AxisVector{0, 3, 1, 2}, shape_nchw);
+    auto absn = make_shared<op::v0::Abs>(reshape);
+    auto neg = make_shared<op::v0::Negative>(reshape);
+    auto func = make_shared<Function>(OutputVector{absn, neg}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeSinking>();
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.register_pass<pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(func);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Reshape>(func), 1);
+    ASSERT_EQ(absn->get_argument(0), reshape);
+    ASSERT_EQ(neg->get_argument(0), reshape);
+}
+
 TEST(reshape_sinking, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::ReshapeSinking>();
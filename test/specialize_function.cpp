@@ -17,7 +17,10 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "util/test_tools.hpp"
 
 using namespace ngraph;
 
@@ -362,3 +365,88 @@ TEST(specialize_function, share_constants_with_cf)
     ASSERT_EQ(add_const_1->get_output_target_inputs(0).size(), 1);
     ASSERT_EQ(add_const_2->get_output_target_inputs(0).size(), 1);
 }
+
+// Test checks that cloned constants share their data with the original
+namespace
+{
+    // Forwards to a real backend and remembers what it was asked to compile
+    class CompileRecorder : public runtime::Backend
+    {
+    public:
+        CompileRecorder(const std::shared_ptr<runtime::Backend>& backend)
+            : m_backend(backend)
+        {
+        }
+        std::shared_ptr<runtime::Tensor> create_tensor() override
+        {
+            return m_backend->create_tensor();
+        }
+        std::shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                       const Shape& shape) override
+        {
+            return m_backend->create_tensor(element_type, shape);
+        }
+        std::shared_ptr<runtime::Tensor> create_tensor(const element::Type& element_type,
+                                                       const Shape& shape,
+                                                       void* memory_pointer) override
+        {
+            return m_backend->create_tensor(element_type, shape, memory_pointer);
+        }
+        std::shared_ptr<runtime::Executable> compile(std::shared_ptr<Function> func,
+                                                     bool enable_performance_data) override
+        {
+            m_compiled.push_back(func);
+            return m_backend->compile(func, enable_performance_data);
+        }
+
+        std::shared_ptr<runtime::Backend> m_backend;
+        std::vector<std::shared_ptr<Function>> m_compiled;
+    };
+}
+
+TEST(specialize_function, dynamic_executable_folds_static_subgraphs_once)
+{
+    auto p0 = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension(), 3});
+    auto weights =
+        op::v0::Constant::create(element::f32, Shape{3, 3}, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    // Depends on no parameter, so it can be folded before knowing any shape
+    auto transposed = std::make_shared<op::v0::Reshape>(weights, AxisVector{1, 0}, Shape{3, 3});
+    auto dot = std::make_shared<op::v0::Dot>(p0, transposed);
+    auto f = std::make_shared<Function>(dot, ParameterVector{p0});
+
+    auto recorder = std::make_shared<CompileRecorder>(runtime::Backend::create("INTERPRETER"));
+    auto backend = std::make_shared<runtime::dynamic::DynamicBackend>(recorder);
+    auto handle = backend->compile(f);
+
+    for (size_t rows : {2, 4})
+    {
+        auto a = backend->create_tensor(element::f32, Shape{rows, 3});
+        copy_data(a, std::vector<float>(rows * 3, 1.0f));
+        auto result = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic());
+        handle->call({result}, {a});
+        EXPECT_EQ(result->get_shape(), (Shape{rows, 3}));
+        EXPECT_EQ(read_vector<float>(result)[0], 6.0f);
+    }
+
+    // Each shape got its own specialization, and both reuse the transposed weights that were
+    // folded once up front instead of folding their own copy
+    ASSERT_EQ(recorder->m_compiled.size(), 2);
+    std::vector<const void*> folded;
+    for (auto& compiled : recorder->m_compiled)
+    {
+        EXPECT_EQ(count_ops_of_type<op::v0::Reshape>(compiled), 0);
+        for (auto& node : compiled->get_ops())
+        {
+            if (auto constant = as_type_ptr<op::v0::Constant>(node))
+            {
+                folded.push_back(constant->get_data_ptr());
+            }
+        }
+    }
+    ASSERT_EQ(folded.size(), 2);
+    EXPECT_EQ(folded[0], folded[1]);
+    EXPECT_NE(folded[0], weights->get_data_ptr());
+
+    // The function handed to the backend is left alone
+    EXPECT_EQ(count_ops_of_type<op::v0::Reshape>(f), 1);
+}
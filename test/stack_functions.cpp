@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/stack_functions.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Function> make_mlp(float weight)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto w = op::v0::Constant::create(element::f32, Shape{3, 2}, vector<float>(6, weight));
+    auto relu = make_shared<op::v0::Relu>(make_shared<op::v0::Dot>(x, w));
+    return make_shared<Function>(relu, ParameterVector{x});
+}
+
+TEST(stack_functions, dot_becomes_batch_mat_mul)
+{
+    auto f = stack_functions({make_mlp(1), make_mlp(2), make_mlp(-1)});
+
+    ASSERT_EQ(f->get_parameters().size(), 3);
+    ASSERT_EQ(f->get_results().size(), 3);
+    ASSERT_EQ(count_ops_of_type<op::v0::Dot>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::BatchMatMul>(f), 1);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto handle = backend->compile(f);
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t k = 0; k < 3; ++k)
+    {
+        inputs.push_back(backend->create_tensor(element::f32, Shape{2, 3}));
+        copy_data(inputs.back(), vector<float>{1, 2, 3, 4, 5, 6});
+        outputs.push_back(backend->create_tensor(element::f32, Shape{2, 2}));
+    }
+    handle->call_with_validate(outputs, inputs);
+
+    EXPECT_TRUE(test::all_close_f(vector<float>{6, 6, 15, 15}, read_vector<float>(outputs[0])));
+    EXPECT_TRUE(test::all_close_f(vector<float>{12, 12, 30, 30}, read_vector<float>(outputs[1])));
+    EXPECT_TRUE(test::all_close_f(vector<float>{0, 0, 0, 0}, read_vector<float>(outputs[2])));
+}
+
+TEST(stack_functions, structure_mismatch)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto g = make_shared<Function>(make_shared<op::v0::Abs>(x), ParameterVector{x});
+
+    EXPECT_THROW(stack_functions({make_mlp(1), g}), ngraph_error);
+}
+
+static shared_ptr<Function> make_conv(float weight,
+                                      const CoordinateDiff& padding_below = CoordinateDiff{1, 0},
+                                      const CoordinateDiff& padding_above = CoordinateDiff{0, 1})
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    vector<float> filters(3 * 2 * 2 * 2);
+    for (size_t i = 0; i < filters.size(); ++i)
+    {
+        filters[i] = weight * (static_cast<float>(i % 5) - 2);
+    }
+    auto w = op::v0::Constant::create(element::f32, Shape{3, 2, 2, 2}, filters);
+    auto conv = make_shared<op::v0::Convolution>(
+        x, w, Strides{1, 1}, Strides{1, 1}, padding_below, padding_above);
+    return make_shared<Function>(make_shared<op::v0::Relu>(conv), ParameterVector{x});
+}
+
+TEST(stack_functions, convolution_becomes_group_convolution)
+{
+    vector<float> weights{1, 0.5f, -2};
+    vector<shared_ptr<Function>> functions;
+    for (auto weight : weights)
+    {
+        functions.push_back(make_conv(weight));
+    }
+    auto f = stack_functions(functions);
+    ASSERT_EQ(count_ops_of_type<op::v0::Convolution>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::GroupConvolution>(f), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (size_t k = 0; k < weights.size(); ++k)
+    {
+        vector<float> tensor_val(shape_size(Shape{1, 2, 4, 4}));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto stacked_results = execute(f, args, "INTERPRETER");
+    for (size_t k = 0; k < weights.size(); ++k)
+    {
+        auto expected =
+            execute(make_conv(weights[k]), vector<vector<float>>{args[k]}, "INTERPRETER");
+        EXPECT_TRUE(test::all_close_f(expected.at(0), stacked_results.at(k)));
+    }
+}
+
+TEST(stack_functions, attribute_mismatch)
+{
+    // Same shapes, but the padding is on the other side
+    auto g = make_conv(2, CoordinateDiff{0, 1}, CoordinateDiff{1, 0});
+    EXPECT_THROW(stack_functions({make_conv(1), g}), ngraph_error);
+}
@@ -0,0 +1,206 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/strength_reduction.hpp"
+#include "util/all_close_f.hpp"
+#include "util/random.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Node> make_uniform(float value, const Shape& shape)
+{
+    auto c = op::v0::Constant::create(element::f32, Shape{}, {value});
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        axes.insert(i);
+    }
+    return make_shared<op::v0::Broadcast>(c, shape, axes);
+}
+
+static void run_strength_reduction(shared_ptr<Function> f, pass::StrengthReductionMask numerics)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::StrengthReduction>(numerics);
+    pass_manager.run_passes(f);
+}
+
+// Runs make_f() with and without the pass on the interpreter and compares the results
+static void check_against_original(function<shared_ptr<Function>()> make_f,
+                                   pass::StrengthReductionMask numerics,
+                                   float low = -1.0f,
+                                   float high = 1.0f)
+{
+    auto f = make_f();
+    auto reduced_f = make_f();
+    run_strength_reduction(reduced_f, numerics);
+
+    test::Uniform<float> rng(low, high);
+    vector<vector<float>> args;
+    for (auto param : f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto expected = execute(f, args, "INTERPRETER");
+    auto actual = execute(reduced_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(expected.at(0), actual.at(0)));
+}
+
+TEST(strength_reduction, power)
+{
+    Shape shape{2, 3};
+    auto make_f = [shape](float exponent) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto power = make_shared<op::v1::Power>(A, make_uniform(exponent, shape));
+        return make_shared<Function>(power, ParameterVector{A});
+    };
+
+    auto square = make_f(2);
+    run_strength_reduction(square, pass::StrengthReductionType::EXACT);
+    EXPECT_EQ(count_ops_of_type<op::v1::Power>(square), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(square), 1);
+
+    // sqrt rounds differently from pow, so it needs APPROXIMATE
+    auto root = make_f(0.5);
+    run_strength_reduction(root, pass::StrengthReductionType::EXACT);
+    EXPECT_EQ(count_ops_of_type<op::v1::Power>(root), 1);
+    run_strength_reduction(root, pass::StrengthReductionType::APPROXIMATE);
+    EXPECT_EQ(count_ops_of_type<op::v1::Power>(root), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Sqrt>(root), 1);
+
+    for (float exponent : {1.0f, 2.0f, 3.0f, 4.0f, 0.5f, -1.0f, -0.5f})
+    {
+        check_against_original(
+            [&] { return make_f(exponent); }, pass::StrengthReductionType::ALL, 0.5f, 2.0f);
+    }
+}
+
+TEST(strength_reduction, divide_by_constant)
+{
+    Shape shape{4};
+    auto make_f = [shape](float divisor) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto divide = make_shared<op::v1::Divide>(A, make_uniform(divisor, shape));
+        return make_shared<Function>(divide, ParameterVector{A});
+    };
+
+    // Dividing by a power of two is exactly a multiply by its reciprocal
+    auto by_four = make_f(4);
+    run_strength_reduction(by_four, pass::StrengthReductionType::EXACT);
+    EXPECT_EQ(count_ops_of_type<op::v1::Divide>(by_four), 0);
+
+    auto by_three = make_f(3);
+    run_strength_reduction(by_three, pass::StrengthReductionType::EXACT);
+    EXPECT_EQ(count_ops_of_type<op::v1::Divide>(by_three), 1);
+    check_against_original([&] { return make_f(3); }, pass::StrengthReductionType::APPROXIMATE);
+}
+
+TEST(strength_reduction, constant_chain)
+{
+    Shape shape{2, 2};
+    auto make_f = [shape] {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto m1 = make_shared<op::v1::Multiply>(A, make_uniform(2, shape));
+        auto m2 = make_shared<op::v1::Multiply>(make_uniform(3, shape), m1);
+        auto m3 = make_shared<op::v1::Multiply>(m2, make_uniform(4, shape));
+        auto a1 = make_shared<op::v1::Add>(m3, make_uniform(1, shape));
+        auto a2 = make_shared<op::v1::Add>(a1, make_uniform(-5, shape));
+        return make_shared<Function>(a2, ParameterVector{A});
+    };
+
+    auto f = make_f();
+    run_strength_reduction(f, pass::StrengthReductionType::APPROXIMATE);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 1);
+    check_against_original(make_f, pass::StrengthReductionType::APPROXIMATE);
+}
+
+TEST(strength_reduction, sum_of_product_to_dot)
+{
+    auto make_matrix_vector = [] {
+        auto X = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+        auto v = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto bv = make_shared<op::v0::Broadcast>(v, Shape{3, 4}, AxisSet{0});
+        auto sum = make_shared<op::v0::Sum>(make_shared<op::v1::Multiply>(X, bv), AxisSet{1});
+        return make_shared<Function>(sum, ParameterVector{X, v});
+    };
+    auto make_vector_matrix = [] {
+        auto X = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+        auto v = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+        auto bv = make_shared<op::v0::Broadcast>(v, Shape{3, 4}, AxisSet{1});
+        auto sum = make_shared<op::v0::Sum>(make_shared<op::v1::Multiply>(bv, X), AxisSet{0});
+        return make_shared<Function>(sum, ParameterVector{X, v});
+    };
+    auto make_full = [] {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto sum =
+            make_shared<op::v0::Sum>(make_shared<op::v1::Multiply>(A, B), AxisSet{0, 1});
+        return make_shared<Function>(sum, ParameterVector{A, B});
+    };
+
+    vector<function<shared_ptr<Function>()>> makers{
+        make_matrix_vector, make_vector_matrix, make_full};
+    for (auto make_f : makers)
+    {
+        auto f = make_f();
+        run_strength_reduction(f, pass::StrengthReductionType::APPROXIMATE);
+        EXPECT_EQ(count_ops_of_type<op::v0::Sum>(f), 0);
+        EXPECT_EQ(count_ops_of_type<op::v0::Dot>(f), 1);
+        check_against_original(make_f, pass::StrengthReductionType::APPROXIMATE);
+    }
+
+    // The broadcast axis is reduced, which is not a contraction
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+    auto v = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto bv = make_shared<op::v0::Broadcast>(v, Shape{3, 4}, AxisSet{0});
+    auto sum = make_shared<op::v0::Sum>(make_shared<op::v1::Multiply>(X, bv), AxisSet{0});
+    auto f = make_shared<Function>(sum, ParameterVector{X, v});
+    run_strength_reduction(f, pass::StrengthReductionType::ALL);
+    EXPECT_EQ(count_ops_of_type<op::v0::Dot>(f), 0);
+}
+
+TEST(strength_reduction, exp_log)
+{
+    auto make_f = [] {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto exp_log = make_shared<op::v0::Exp>(make_shared<op::v0::Log>(A));
+        auto log_exp = make_shared<op::v0::Log>(make_shared<op::v0::Exp>(A));
+        return make_shared<Function>(make_shared<op::v1::Add>(exp_log, log_exp),
+                                     ParameterVector{A});
+    };
+
+    // exp(log(x)) is NaN for negative x, so the rewrite is not applied by default
+    auto f = make_f();
+    run_strength_reduction(f,
+                           pass::StrengthReductionMask(pass::StrengthReductionType::EXACT) |
+                               pass::StrengthReductionType::APPROXIMATE);
+    EXPECT_EQ(count_ops_of_type<op::v0::Exp>(f), 2);
+
+    run_strength_reduction(f, pass::StrengthReductionType::UNSAFE_DOMAIN);
+    EXPECT_EQ(count_ops_of_type<op::v0::Exp>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Log>(f), 0);
+    check_against_original(make_f, pass::StrengthReductionType::ALL, 0.5f, 2.0f);
+}
@@ -16,8 +16,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -25,6 +27,7 @@
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -89,3 +92,88 @@ TEST(tensor, output_flag)
         EXPECT_TRUE(f0->get_output_op(i)->is_output());
     }
 }
+
+TEST(tensor, write_async)
+{
+    Shape shape{2, 3};
+    vector<shared_ptr<runtime::Tensor>> slots{make_shared<runtime::HostTensor>(element::f32, shape),
+                                              make_shared<runtime::HostTensor>(element::f32, shape)};
+    vector<vector<float>> data{{1, 2, 3, 4, 5, 6}, {6, 5, 4, 3, 2, 1}};
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        slots[i]->write_async(data[i].data(), data[i].size() * sizeof(float));
+    }
+    for (size_t i = 0; i < slots.size(); ++i)
+    {
+        slots[i]->wait_for_read_ready();
+        vector<float> result(shape_size(shape));
+        slots[i]->read(result.data(), result.size() * sizeof(float));
+        EXPECT_EQ(data[i], result);
+    }
+}
+
+TEST(tensor, write_async_concurrent_readers)
+{
+    Shape shape{1024, 1024};
+    auto t = make_shared<runtime::HostTensor>(element::f32, shape);
+    vector<float> data(shape_size(shape));
+    iota(data.begin(), data.end(), 0.0f);
+    t->write_async(data.data(), data.size() * sizeof(float));
+
+    // Every reader waits for the staged copy, not only the one that clears the fence
+    vector<vector<float>> results(4, vector<float>(data.size()));
+    vector<thread> readers;
+    for (auto& result : results)
+    {
+        readers.emplace_back(
+            [&t, &result]() { t->read(result.data(), result.size() * sizeof(float)); });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    for (auto& result : results)
+    {
+        EXPECT_EQ(data, result);
+    }
+}
+
+TEST(tensor, write_after_write_async)
+{
+    Shape shape{1024, 1024};
+    auto t = make_shared<runtime::HostTensor>(element::f32, shape);
+    vector<float> staged(shape_size(shape), 1.0f);
+    vector<float> direct(shape_size(shape), 2.0f);
+
+    // The synchronous write waits for the staged one, so it lands last
+    t->write_async(staged.data(), staged.size() * sizeof(float));
+    t->write(direct.data(), direct.size() * sizeof(float));
+    vector<float> result(shape_size(shape));
+    t->read(result.data(), result.size() * sizeof(float));
+    EXPECT_EQ(direct, result);
+}
+
+TEST(tensor, write_async_error)
+{
+    auto t = make_shared<runtime::HostTensor>(element::f32, Shape{4});
+    vector<float> data{1, 2};
+    // Partial writes are rejected by HostTensor; the error surfaces at the fence
+    t->write_async(data.data(), data.size() * sizeof(float));
+    EXPECT_THROW(t->wait_for_read_ready(), out_of_range);
+    // The fence is cleared once the failure has been reported
+    EXPECT_NO_THROW(t->wait_for_write_ready());
+}
+
+TEST(tensor, version)
+{
+    auto a = make_shared<runtime::HostTensor>(element::f32, Shape{4});
+    auto b = make_shared<runtime::HostTensor>(element::f32, Shape{4});
+    EXPECT_NE(a->get_version(), b->get_version());
+
+    auto version = a->get_version();
+    a->set_stale(false);
+    EXPECT_EQ(version, a->get_version());
+    a->set_stale(true);
+    EXPECT_NE(version, a->get_version());
+    EXPECT_NE(b->get_version(), a->get_version());
+}